@@ -0,0 +1,106 @@
+#include "Analysis.h"
+
+/*
+ * A position of the batch, as a job of the worker pool.
+ */
+struct PositionJob{
+	long lineNumber;
+	char fen[Analysis_LINE_LENGTH];
+	char result[Analysis_RESULT_LENGTH];
+	long nodes;     /* -1 if the line isn't a valid position */
+};
+
+/*
+ * Analyses a position, and writes its result to a buffer.
+ *
+ * @params: (fen) - the position
+ *          (result) - the buffer, of at least Analysis_RESULT_LENGTH characters
+ * @return: the number of nodes searched, or -1 if the position isn't valid
+ */
+static long analysePosition(struct Analysis* analysis, struct Search* search, const char* fen, char* result){
+	struct Board board;
+	int player;
+	if (!Board_readFen(&board, fen, &player)){
+		sprintf(result, "error");
+		return -1;
+	}
+	int length = Board_writeFen(&board, player, result);
+	if (!Board_hasPossibleMove(&board, player)){
+		sprintf(result+length, " bestmove none");
+		return 0;
+	}
+	struct PrincipalVariation line;
+	Search_clear(search);
+	Search_multiPV(search, &board, player, 1, analysis->maxDepth, analysis->timePerMove, &line);
+	long nodes = Search_nodes(search);
+	length += sprintf(result+length, " bestmove ");
+	length += Move_toString(&line.moves[0], result+length);
+	length += sprintf(result+length, " score %d nodes %ld pv", line.score, nodes);
+	for (int i = 0; i < line.length; i++){
+		result[length++] = ' ';
+		length += Move_toString(&line.moves[i], result+length);
+	}
+	return nodes;
+}
+
+/*
+ * Takes the next position to be analysed, skipping empty lines and comments.
+ *
+ * @return: 1 (true) if a position was taken, 0 (false) at the end of the input
+ */
+static int takePosition(void* batch, void* job){
+	struct Analysis* analysis = (struct Analysis*)batch;
+	struct PositionJob* position = (struct PositionJob*)job;
+	while (fgets(position->fen, sizeof(position->fen), analysis->input) != NULL){
+		position->lineNumber = ++analysis->numOfLines;
+		position->fen[strcspn(position->fen, "\r\n")] = '\0';
+		char first = position->fen[strspn(position->fen, " \t")];
+		if (first != '\0' && first != '#'){
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/*
+ * Analyses a position.
+ */
+static void analyseJob(void* batch, struct Search* search, void* job){
+	struct PositionJob* position = (struct PositionJob*)job;
+	position->nodes = analysePosition((struct Analysis*)batch, search, position->fen, position->result);
+}
+
+/*
+ * Writes the result of a position that was analysed.
+ */
+static void finishPosition(void* batch, void* job){
+	struct Analysis* analysis = (struct Analysis*)batch;
+	struct PositionJob* position = (struct PositionJob*)job;
+	if (position->nodes < 0){
+		fprintf(analysis->output, "%ld %s %s\n", position->lineNumber, position->fen, position->result);
+		analysis->numOfErrors++;
+	}
+	else{
+		fprintf(analysis->output, "%ld %s\n", position->lineNumber, position->result);
+		analysis->numOfPositions++;
+		analysis->nodes += position->nodes;
+	}
+	fflush(analysis->output);
+}
+
+/*
+ * Analyses all the positions of the input, and waits for all of them to be done.
+ *
+ * @params: (analysis) - the batch, whose settings must be filled in
+ *          (numOfThreads) - the number of threads in the pool, between 1 to WorkerPool_MAX_THREADS
+ * @return: the number of positions analysed, or -1 if not all of the input could be analysed
+ */
+long Analysis_run(struct Analysis* analysis, int numOfThreads){
+	struct WorkerPool pool = {analysis, sizeof(struct PositionJob), analysis->hashSize, &takePosition, &analyseJob, &finishPosition};
+	analysis->numOfLines = 0;
+	analysis->numOfPositions = 0;
+	analysis->numOfErrors = 0;
+	analysis->nodes = 0;
+	WorkerPool_run(&pool, numOfThreads);
+	return feof(analysis->input)? analysis->numOfPositions : -1;
+}
@@ -0,0 +1,29 @@
+#include "SelfPlay.c"
+
+#define Analysis_LINE_LENGTH 1024
+#define Analysis_RESULT_LENGTH (Board_FEN_LENGTH + 64 + Search_MAX_PV_LENGTH*(Move_STRING_LENGTH+1))
+
+/*
+ * A batch analysis of positions, one FEN per line of the input (see Board_readFen), by a worker
+ * pool. The input is read as it is analysed, one line at a time, so a file of any size takes
+ * no more memory than a single position. Every thread's search is cleared before every position, so a position's
+ * result doesn't depend on the thread that analysed it or on the positions before it (as long as
+ * the search has no time limit). Every result is written as soon as it is found, as a line:
+ * the number of the position's line in the input, its FEN, and "bestmove <move> score <score>
+ * nodes <nodes> pv <moves>", or "bestmove none" if the player to move has no possible move,
+ * or "error" if the line isn't a valid position. Empty lines and lines starting with '#' are skipped.
+ */
+struct Analysis{
+	int maxDepth;
+	long timePerMove;       /* in milliseconds, 0 for no limit */
+	int hashSize;           /* the size of every thread's transposition table, in megabytes */
+	FILE* input;
+	FILE* output;
+	/* the state of the batch, shared by the threads */
+	long numOfLines;        /* the lines read from the input so far */
+	long numOfPositions;    /* the positions analysed */
+	long numOfErrors;       /* the lines that aren't valid positions */
+	long nodes;             /* the nodes searched by all the threads */
+};
+
+long Analysis_run(struct Analysis* analysis, int numOfThreads);
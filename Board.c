@@ -1,53 +1,176 @@
 #include <stdio.h>
 #include "Board.h"
+#include "BoardTables.h"
 #define BLACK 0
 #define WHITE 1
 
+#define MAX_CAPTURES  20 /* all the pieces of a player */
+
+/* diagonal directions, indexed so that the opposite of (d) is (3-d) */
+#define UP_RIGHT   0
+#define UP_LEFT    1
+#define DOWN_RIGHT 2
+#define DOWN_LEFT  3
+
 /*
- * Creates a new board structure.
+ * Shifts all the squares of a mask one step in a diagonal direction.
+ * Squares that fall off the board are dropped.
+ *
+ * @params: (bits) - the mask to be shifted
+ *          (direction) - one of the four diagonal directions
+ * @return: the shifted mask
+ */
+static uint64_t shift(uint64_t bits, int direction){
+	switch (direction){
+		case UP_RIGHT:
+			return (bits << 6) & Board_VALID_SQUARES;
+		case UP_LEFT:
+			return (bits << 5) & Board_VALID_SQUARES;
+		case DOWN_RIGHT:
+			return (bits >> 5) & Board_VALID_SQUARES;
+		default:
+			return (bits >> 6) & Board_VALID_SQUARES;
+	}
+}
+
+/*
+ * Finds the square of a ray that is nearest to the square the ray starts from. The rays
+ * going up run towards the higher bits, and the rays going down towards the lower bits.
  *
- * @return:  NULL if an allocation error occurred, the new board structured as a two-dimensional char array otherwise
+ * @params: (squares) - a non-empty mask of squares on a single ray
+ *          (direction) - the direction of the ray
+ * @return: the bit position of the nearest square
  */
-char** Board_new(){
-	char** board = calloc(Board_SIZE, sizeof(char*));
-	if (!board){
-		return NULL;
+static int nearestSquare(uint64_t squares, int direction){
+	if (direction == UP_RIGHT || direction == UP_LEFT){
+		return bitScan(squares);
 	}
-	for(int i = 0; i < Board_SIZE; i++){
-		board[i] = calloc(Board_SIZE, sizeof(char));
+	return bitScanReverse(squares);
+}
+
+/*
+ * Checks whether the input coordinates are within the range of the board's length and width.
+ *
+ * @params: (x, y) - the coordinates to be checked
+ * @return: 1 (ture) if the coordinates correspond to a valid position on the board, 0 (false) otherwise
+ */
+static int isInRange(int x, int y){
+	if (x >= 1 && x <= Board_SIZE && y >= 1 && y <= Board_SIZE){
+		return 1;
 	}
-	return board;
+	return 0;
+}
+
+/*
+ * Checks whether the input coordinates correspond to a black tile on the board.
+ *
+ * @params: (x, y) - the coordinates to be checked
+ * @return: 1 (true) if the coordinates correspond to a black tile on the board, 0 (false) otherwise
+ */
+static int isOnBlack(int x, int y){
+	return !((x+y)%2);
 }
 
+/*
+ * @params: (x, y) - the coordinates of a position on the board
+ * @return: the mask of the square in the given position, or 0 if the position is not playable
+ */
+static uint64_t squareMask(int x, int y){
+	if (!isInRange(x, y) || !isOnBlack(x, y)){
+		return 0;
+	}
+	return 1ULL << (((x-1) + 11*(y-1))/2);
+}
 
 /*
- * Populates the board in the standard way.
+ * @return: the mask of all the pieces of a player
  */
-void Board_init(char** board){
-	for (int x = 0; x < Board_SIZE; x++){
-		for (int y = 0; y < Board_SIZE; y++){
-			if ((x + y) % 2 == 0){
-				if (y <= 3){
-					board[x][y] = Board_WHITE_MAN;
-					continue;
-				}
-				if (y >= 6){
-					board[x][y] = Board_BLACK_MAN;
-					continue;
-				}
-			}
-			board[x][y] = Board_EMPTY;
-		}
+static uint64_t piecesOf(struct Board* board, int player){
+	return board->men[player] | board->kings[player];
+}
+
+/*
+ * @return: the mask of all the empty squares on the board
+ */
+static uint64_t emptySquares(struct Board* board){
+	return ~(piecesOf(board, WHITE) | piecesOf(board, BLACK)) & Board_VALID_SQUARES;
+}
+
+/*
+ * The Zobrist key of a single piece, derived from its square and type by a fixed
+ * mixing function, so that no table has to be initialized before use.
+ *
+ * @params: (bit) - the index of the square
+ *          (type) - the type of the piece: its color, plus 2 for a king
+ * @return: the key of the piece
+ */
+static uint64_t zobristKey(int bit, int type){
+	uint64_t z = 0x9E3779B97F4A7C15ULL * (uint64_t)(4*bit + type + 1);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+	return z ^ (z >> 31);
+}
+
+/*
+ * Adds pieces of one type to the board, or removes them if they are already there,
+ * and updates the key and the material of the board accordingly.
+ *
+ * @params: (squares) - the mask of the squares of the pieces, either all empty or all holding such pieces
+ *          (player) - the color of the pieces
+ *          (isKing) - 1 if the pieces are kings, 0 if they are men
+ */
+static void togglePieces(struct Board* board, uint64_t squares, int player, int isKing){
+	if (!squares){
+		return;
+	}
+	uint64_t* pieces = isKing? &board->kings[player] : &board->men[player];
+	int value = (isKing? Board_KING_VALUE : Board_MAN_VALUE) * bitCount(squares);
+	board->material[player] += (*pieces & squares)? -value : value;
+	*pieces ^= squares;
+	for (; squares; squares &= squares - 1){
+		board->key ^= zobristKey(bitScan(squares), player + 2*isKing);
 	}
 }
 
+/*
+ * Creates a new board structure.
+ *
+ * @return:  NULL if an allocation error occurred, the new empty board otherwise
+ */
+struct Board* Board_new(){
+	struct Board* board = calloc(1, sizeof(struct Board));
+	if (!board){
+		return NULL;
+	}
+	return board;
+}
+
 /*
  * Clears the board from all pieces.
  */
-void Board_clear(char** board){
-	for (int x = 0; x < Board_SIZE; x++){
-		for (int y = 0; y < Board_SIZE; y++){
-			board[x][y] = Board_EMPTY;
+void Board_clear(struct Board* board){
+	board->men[WHITE] = 0;
+	board->men[BLACK] = 0;
+	board->kings[WHITE] = 0;
+	board->kings[BLACK] = 0;
+	board->key = 0;
+	board->material[WHITE] = 0;
+	board->material[BLACK] = 0;
+}
+
+/*
+ * Populates the board in the standard way.
+ */
+void Board_init(struct Board* board){
+	Board_clear(board);
+	for (int x = 1; x <= Board_SIZE; x++){
+		for (int y = 1; y <= Board_SIZE; y++){
+			if (y <= 4){
+				togglePieces(board, squareMask(x, y), WHITE, 0);
+			}
+			if (y >= 7){
+				togglePieces(board, squareMask(x, y), BLACK, 0);
+			}
 		}
 	}
 }
@@ -55,15 +178,11 @@ void Board_clear(char** board){
 /*
  * Populates a board according to another board.
  *
- * @params: (dest) - a pointer to the board to be populated, 
+ * @params: (dest) - a pointer to the board to be populated,
  *          (src)  - a pointer to the board according to whom (dest) will be populated
  */
-void Board_copy(char** dest, char** src){
-	for (int x = 0; x < Board_SIZE; x++){
-		for (int y = 0; y < Board_SIZE; y++){
-			dest[x][y] = src[x][y];
-		}
-	}
+void Board_copy(struct Board* dest, struct Board* src){
+	*dest = *src;
 }
 
 /*
@@ -72,8 +191,21 @@ void Board_copy(char** dest, char** src){
  * @params: (x, y)  - the coordinates of the position to be populated
  *          (piece) - the piece to be placed on the board.
  */
-void Board_setPiece(char** board, int x, int y, char piece){
-	board[x-1][y-1] = piece;
+void Board_setPiece(struct Board* board, int x, int y, char piece){
+	uint64_t square = squareMask(x, y);
+	Board_removePiece(board, x, y);
+	if (piece == Board_WHITE_MAN){
+		togglePieces(board, square, WHITE, 0);
+	}
+	if (piece == Board_WHITE_KING){
+		togglePieces(board, square, WHITE, 1);
+	}
+	if (piece == Board_BLACK_MAN){
+		togglePieces(board, square, BLACK, 0);
+	}
+	if (piece == Board_BLACK_KING){
+		togglePieces(board, square, BLACK, 1);
+	}
 }
 
 /*
@@ -82,8 +214,21 @@ void Board_setPiece(char** board, int x, int y, char piece){
  * @params: (x, y)  - the coordinates of the position from which to retrieve the piece
  * @return: the piece in the specified position
  */
-char Board_getPiece(char** board, int x, int y){
-	return board[x-1][y-1];
+char Board_getPiece(struct Board* board, int x, int y){
+	uint64_t square = squareMask(x, y);
+	if (board->men[WHITE] & square){
+		return Board_WHITE_MAN;
+	}
+	if (board->kings[WHITE] & square){
+		return Board_WHITE_KING;
+	}
+	if (board->men[BLACK] & square){
+		return Board_BLACK_MAN;
+	}
+	if (board->kings[BLACK] & square){
+		return Board_BLACK_KING;
+	}
+	return Board_EMPTY;
 }
 
 /*
@@ -92,43 +237,24 @@ char Board_getPiece(char** board, int x, int y){
  * @params: (x, y) - the coordinates of the position from which the piece will be removed
  * @return: the removed piece
  */
-char Board_removePiece(char** board, int x, int y){
+char Board_removePiece(struct Board* board, int x, int y){
 	char piece = Board_getPiece(board, x, y);
-	board[x-1][y-1] = Board_EMPTY;
+	uint64_t square = squareMask(x, y);
+	togglePieces(board, board->men[WHITE] & square, WHITE, 0);
+	togglePieces(board, board->men[BLACK] & square, BLACK, 0);
+	togglePieces(board, board->kings[WHITE] & square, WHITE, 1);
+	togglePieces(board, board->kings[BLACK] & square, BLACK, 1);
 	return piece;
 }
 
-/*
- * Checks whether the input coordinates are within the range of the board's length and width.
- *
- * @params: (x, y) - the coordinates to be checked
- * @return: 1 (ture) if the coordinates correspond to a valid position on the board, 0 (false) otherwise
- */
-static int isInRange(int x, int y){
-	if (x >= 1 && x <= Board_SIZE && y >= 1 && y <= Board_SIZE){
-		return 1;
-	}
-	return 0;
-}
-
-/*
- * Checks whether the input coordinates correspond to a black tile on the board.
- *
- * @params: (x, y) - the coordinates to be checked
- * @return: 1 (true) if the coordinates correspond to a black tile on the board, 0 (false) otherwise
- */
-static int isOnBlack(int x, int y){
-	return !((x+y)%2);
-}
-
 /*
  * Checks whether the input coordinates correspond to an empty tile on the board.
  *
  * @params: (x, y) - the coordinates to be checked
  * @return: 1 (true) if the coordinates correspond to an empty tile on the board, 0 (false) otherwise
  */
-int Board_isEmpty(char** board, int x, int y){
-	return board[x-1][y-1] == Board_EMPTY;
+int Board_isEmpty(struct Board* board, int x, int y){
+	return (emptySquares(board) & squareMask(x, y)) != 0;
 }
 
 /*
@@ -138,152 +264,238 @@ int Board_isEmpty(char** board, int x, int y){
  * @params: (x, y) - the coordinates to be checked
  * @return: 1 (true) if the coordinates correspond to a valid position on the board, 0 (false) otherwise
  */
-int Board_isValidPosition(char** board, int x, int y){
+int Board_isValidPosition(struct Board* board, int x, int y){
 	return (isInRange(x,y) && isOnBlack(x,y));
 }
 
 /*
  * Checks whether the input board is playable. Specifically, checks that the board is not empty,
- * has pieces of both colors, and that no color has over 20 pieces.  
+ * has pieces of both colors, and that no color has over 20 pieces.
  *
- * @params: (board) - the board to be checked		
+ * @params: (board) - the board to be checked
  * @return: 1 (true) if the board is playable, 0 (false) otherwise
  */
-int Board_isPlayable(char** board){
-	int countBlack = 0;
-	int countWhite = 0;
-	for (int x = 1; x <= Board_SIZE; x++){
-		for (int y = 1; y <= Board_SIZE; y++){
-			char piece = Board_getPiece(board, x, y);
-			if (piece == Board_BLACK_KING || piece == Board_BLACK_MAN){
-				countBlack++;
-				continue;
-			}
-			if (piece == Board_WHITE_KING || piece == Board_WHITE_MAN){
-				countWhite++;
-				continue;
-			}
-		}
-	}
+int Board_isPlayable(struct Board* board){
+	int countBlack = bitCount(piecesOf(board, BLACK));
+	int countWhite = bitCount(piecesOf(board, WHITE));
 	int tooFew  = (countBlack == 0 || countWhite == 0);
 	int tooMany = (countBlack > 20 || countWhite > 20);
 	return (!tooFew && !tooMany);
 }
 
 /*
- * Scans the top and bottom rows of the board, and "crowns" the appropriate MAN pieces.  	
+ * @return: the row on which the men of a player are crowned
  */
-static void Board_crownPieces(char** board){
-	for (int x = 1; x <= Board_SIZE; x++){
-		if (Board_getPiece(board, x, 1) == Board_BLACK_MAN) {
-			Board_setPiece(board, x, 1, Board_BLACK_KING);
-		}
-		if (Board_getPiece(board, x, Board_SIZE) == Board_WHITE_MAN){
-			Board_setPiece(board, x, Board_SIZE, Board_WHITE_KING);
-		}
-	}	
+static uint64_t crowningRow(int player){
+	return (player == WHITE)? Board_ROW_10 : Board_ROW_1;
+}
+
+/*
+ * @return: 1 (true) if a character is a decimal digit, 0 (false) otherwise
+ */
+static int isDigit(char c){
+	return c >= '0' && c <= '9';
 }
 
 /*
- * Removes the captured piece as part of a jump move.  
+ * Populates a board according to a position in the FEN notation of draughts, e.g. "W:W31-50:B1-20":
+ * the player to move, followed by the squares of the white and of the black pieces, by their numbers
+ * in the standard notation. Squares are separated by commas, a range of squares is joined by a dash,
+ * and a king's square is prefixed by 'K'. The board is left as it was if the position isn't valid,
+ * which includes having more than 20 pieces of a player.
  *
- * @params: (oldX, oldY) - the coordinates of the piece to be moved
- *			(newX, newY) - the coordinates the piece will be moved to
- */
-static void Board_removeCaptured(char** board, int oldX, int oldY, int newX, int newY){
-	if (abs(newX-oldX) > 1 && abs(newY-oldY) > 1){
-		int currX = oldX;
-		int currY = oldY;
-		while ((currX != newX) && (currY != newY)){
-			Board_removePiece(board, currX, currY);
-			if(newX-oldX>0){
-				currX++;
+ * @params: (fen) - the position
+ *          (player) - a pointer to which the player to move will be written
+ * @return: 1 (true) if the position is valid, 0 (false) otherwise
+ */
+int Board_readFen(struct Board* board, const char* fen, int* player){
+	struct Board position;
+	Board_clear(&position);
+	const char* c = fen;
+	while (*c == ' ' || *c == '"'){
+		c++;
+	}
+	if (*c != 'W' && *c != 'B'){
+		return 0;
+	}
+	int playerToMove = (*c == 'W')? WHITE : BLACK;
+	c++;
+	while (*c == ':'){
+		c++;
+		if (*c != 'W' && *c != 'B'){
+			return 0;
+		}
+		int color = (*c == 'W')? WHITE : BLACK;
+		c++;
+		while (*c == ',' || *c == 'K' || isDigit(*c)){
+			if (*c == ','){
+				c++;
+				continue;
 			}
-			else{
-				currX--;
+			int isKing = (*c == 'K');
+			c += isKing;
+			if (!isDigit(*c)){
+				return 0;
 			}
-			if(newY-oldY>0){
-				currY++;
+			char* end;
+			long first = strtol(c, &end, 10);
+			long last = first;
+			c = end;
+			if (*c == '-' && isDigit(c[1])){
+				last = strtol(c+1, &end, 10);
+				c = end;
 			}
-			else{
-				currY--;
+			if (first < 1 || last > 50 || first > last){
+				return 0;
+			}
+			for (long number = first; number <= last; number++){
+				uint64_t square = 1ULL << Move_squareOfNumber(number);
+				uint64_t occupied = position.men[WHITE] | position.men[BLACK] | position.kings[WHITE] | position.kings[BLACK];
+				if ((square & occupied) || (!isKing && (square & crowningRow(color)))){
+					return 0;
+				}
+				togglePieces(&position, square, color, isKing);
 			}
 		}
 	}
+	while (*c == '.' || *c == '"' || *c == ' ' || *c == '\r' || *c == '\n'){
+		c++;
+	}
+	if (*c != '\0'){
+		return 0;
+	}
+	if (bitCount(piecesOf(&position, WHITE)) > MAX_CAPTURES || bitCount(piecesOf(&position, BLACK)) > MAX_CAPTURES){
+		return 0;
+	}
+	Board_copy(board, &position);
+	*player = playerToMove;
+	return 1;
 }
 
 /*
- * Moves a piece to a different tile in the board.
+ * Writes a board in the FEN notation of draughts, as read by Board_readFen, with every square
+ * listed by itself, e.g. "W:W31,32,K46:B1,2".
  *
- * @params: (oldX, oldY) - the coordinates of the piece to be moved
- *          (newX, newY) - the coordinates the piece will be moved to
- */
-static int Board_move(char** board, int oldX, int oldY, int newX, int newY){
-	char piece = Board_getPiece(board, oldX, oldY);
-	Board_removePiece(board, oldX, oldY);
-	Board_setPiece(board, newX, newY, piece);
-	
-	Board_crownPieces(board);
-	Board_removeCaptured(board, oldX, oldY, newX, newY);
-	if (piece != Board_getPiece(board, oldX, oldY)){ // piece became king after this move
-		return 1;
+ * @params: (player) - the player to move
+ *          (fen) - a buffer of at least Board_FEN_LENGTH characters
+ * @return: the length of the string written
+ */
+int Board_writeFen(struct Board* board, int player, char* fen){
+	static const int colors[] = {WHITE, BLACK};
+	int length = sprintf(fen, "%c", (player == WHITE)? 'W' : 'B');
+	for (int i = 0; i < 2; i++){
+		int color = colors[i];
+		length += sprintf(fen+length, ":%c", (color == WHITE)? 'W' : 'B');
+		const char* separator = "";
+		for (int number = 1; number <= 50; number++){
+			uint64_t square = 1ULL << Move_squareOfNumber(number);
+			if (square & piecesOf(board, color)){
+				length += sprintf(fen+length, "%s%s%d", separator, (square & board->kings[color])? "K" : "", number);
+				separator = ",";
+			}
+		}
 	}
-	return 0;
+	return length;
 }
 
 /*
- * Updates a board according to a possible move.
+ * Carries out a move on the board, in place.
+ * The captured pieces are removed only after the whole move, and a man is crowned
+ * if it ends the move on the far row.
  *
- * @params: (move) - the move to be carried out on the board 
- */
-void Board_update(char** board, struct PossibleMove* move){
-	struct Tile* current = move->start;
-	struct LinkedList* steps = move->steps;
-	struct Iterator iterator;
-	Iterator_init(&iterator, steps);
-	while(Iterator_hasNext(&iterator)){
-		struct Tile* dest = (struct Tile*)Iterator_next(&iterator);
-		Board_move(board, current->x, current->y, dest->x, dest->y);
-		current = dest;
-	}
+ * @params: (move) - the move to be carried out on the board
+ *          (undo) - a pointer to the record that will allow taking the move back
+ */
+void Board_makeMove(struct Board* board, struct Move* move, struct MoveUndo* undo){
+	uint64_t from = 1ULL << Move_getFrom(move);
+	uint64_t to = 1ULL << Move_getTo(move);
+	int player = (piecesOf(board, WHITE) & from)? WHITE : BLACK;
+
+	undo->key = board->key;
+	undo->material[WHITE] = board->material[WHITE];
+	undo->material[BLACK] = board->material[BLACK];
+	undo->capturedMen = board->men[!player] & move->captured;
+	undo->capturedKings = board->kings[!player] & move->captured;
+	togglePieces(board, undo->capturedMen, !player, 0);
+	togglePieces(board, undo->capturedKings, !player, 1);
+
+	int wasKing = (board->kings[player] & from) != 0;
+	undo->promoted = !wasKing && (to & crowningRow(player));
+	togglePieces(board, from, player, wasKing);
+	togglePieces(board, to, player, wasKing || undo->promoted);
 }
 
 /*
- * Creates a board representing the state of the board after a possible move has been carried out.
+ * Takes back a move that was carried out with Board_makeMove.
  *
- * @params: (possibleMove) - a pointer to the move to be carried out.
- * @return: NULL if any allocation errors occurred, the new board otherwise
+ * @params: (move) - the move that was carried out on the board
+ *          (undo) - a pointer to the record filled in when the move was carried out
+ */
+void Board_unmakeMove(struct Board* board, struct Move* move, struct MoveUndo* undo){
+	uint64_t from = 1ULL << Move_getFrom(move);
+	uint64_t to = 1ULL << Move_getTo(move);
+	int player = (piecesOf(board, WHITE) & to)? WHITE : BLACK;
+
+	if (undo->promoted){
+		board->kings[player] &= ~to;
+		board->men[player] |= from;
+	}
+	else if (board->men[player] & to){
+		board->men[player] &= ~to;
+		board->men[player] |= from;
+	}
+	else{
+		board->kings[player] &= ~to;
+		board->kings[player] |= from;
+	}
+	board->men[!player] |= undo->capturedMen;
+	board->kings[!player] |= undo->capturedKings;
+	board->key = undo->key;
+	board->material[WHITE] = undo->material[WHITE];
+	board->material[BLACK] = undo->material[BLACK];
+}
+
+/*
+ * Updates a board according to a move.
+ *
+ * @params: (move) - the move to be carried out on the board
  */
-char** Board_getPossibleBoard(char** board, struct PossibleMove* possibleMove){
-	char** possibleBoard = Board_new();
-	if (!possibleBoard){
-		return NULL;
+void Board_update(struct Board* board, struct Move* move){
+	struct MoveUndo undo;
+	Board_makeMove(board, move, &undo);
+}
+
+/*
+ * @params: (player) - the player to move
+ * @return: the Zobrist hash key of the position, including the player to move
+ */
+uint64_t Board_getKey(struct Board* board, int player){
+	if (player == BLACK){
+		return board->key ^ zobristKey(63, 0);
 	}
-	Board_copy(possibleBoard, board);
-	Board_update(possibleBoard, possibleMove);
-	return possibleBoard;
+	return board->key;
 }
 
 /*
- * Evaluates a single piece on the board according to the provided scoring function. 
+ * Evaluates a single piece on the board according to the provided scoring function.
  *
  * @params: (x,y) - the coordinates of the piece to be evaluated
  *			(color) - the color of the player the scoring function is adjusted for.
  */
-int Board_evalPiece(char** board, int x, int y, int player){
+int Board_evalPiece(struct Board* board, int x, int y, int player){
 	char piece = Board_getPiece(board, x, y);
 	int value = 0;
 	if (piece == Board_WHITE_MAN){
-		value = 1;
+		value = Board_MAN_VALUE;
 	}
 	if (piece == Board_WHITE_KING){
-		value = 3;
+		value = Board_KING_VALUE;
 	}
 	if (piece == Board_BLACK_MAN){
-		value = -1;
+		value = -Board_MAN_VALUE;
 	}
 	if (piece == Board_BLACK_KING){
-		value = -3;
+		value = -Board_KING_VALUE;
 	}
 	if (player == BLACK){
 		return -value;
@@ -292,386 +504,301 @@ int Board_evalPiece(char** board, int x, int y, int player){
 }
 
 /*
- * Determines the color of a piece in a given position.
+ * Finds the kings of a player that can capture an enemy in a given direction.
+ * A king slides over any number of empty squares, and may jump the first piece in its way
+ * if it is an enemy with an empty square right behind it.
  *
- * @params: (x, y) the coordinates of the given position
- * @return: -1 if the position is empty, the color of the piece otherwise
- */
-static int Board_getColor(char** board, int x, int y){
-	char piece = Board_getPiece(board, x, y);
-	if (piece == Board_BLACK_KING || piece == Board_BLACK_MAN){
-		return BLACK;
+ * @params: (kings) - the mask of the kings to be checked
+ *          (direction) - the direction of the capture
+ * @return: the mask of the landing squares, one step beyond each capturable enemy
+ */
+static uint64_t kingCaptureLandings(struct Board* board, uint64_t kings, int player, int direction){
+	uint64_t empty = emptySquares(board);
+	uint64_t landings = 0;
+	for (; kings; kings &= kings - 1){
+		uint64_t blockers = rayMasks[bitScan(kings)][direction] & ~empty;
+		if (!blockers){
+			continue;
+		}
+		int blocker = nearestSquare(blockers, direction);
+		if ((1ULL << blocker) & piecesOf(board, !player)){
+			landings |= neighbourMasks[blocker][direction] & empty;
+		}
 	}
-	if (piece == Board_WHITE_KING || piece == Board_WHITE_MAN){
-		return WHITE;
+	return landings;
+}
+
+/*
+ * @return: the mask of the men of a player that can capture an enemy in a given direction
+ */
+static uint64_t menCapturers(struct Board* board, int player, int direction){
+	int backwards = 3 - direction;
+	uint64_t enemies = piecesOf(board, !player) & shift(emptySquares(board), backwards);
+	return board->men[player] & shift(enemies, backwards);
+}
+
+/*
+ * @return: the forward directions of a player's men
+ */
+static int forwardDirection(int player, int side){
+	if (player == WHITE){
+		return side? UP_LEFT : UP_RIGHT;
 	}
-	return -1;
+	return side? DOWN_LEFT : DOWN_RIGHT;
 }
 
 /*
- * Determines the color of a piece in a given tile.
+ * Checks whether a player currently has any jump move.
  *
- * @params: (tile) - a pointer to the tile on which the piece is
- * @return: -1 if the position is empty, the color of the piece otherwise
+ * @params: (player) - the player the check is done for
+ * @return: 1 (true) if the player can capture, 0 (false) otherwise
  */
-static int Board_getColorByTile(char** board, struct Tile* tile){
-	return Board_getColor(board, tile->x, tile->y);
+int Board_hasPossibleJump(struct Board* board, int player){
+	for (int direction = 0; direction < 4; direction++){
+		if (menCapturers(board, player, direction)){
+			return 1;
+		}
+		if (kingCaptureLandings(board, board->kings[player], player, direction)){
+			return 1;
+		}
+	}
+	return 0;
 }
 
 /*
- * Checks whether a king in a given position can capture an enemy in a given direction
+ * Checks whether a player currently has any possible move, without generating the moves.
+ * The cheap single step checks come first, so most positions are decided by one of them.
  *
- * @params: (x, y) - the coordinates of the given position
- *          (dirX, dirY) - the coordinates if the direction
- * @return: NULL if no such enemy exists, the tile of the enemy otherwise
- */
-static struct Tile* canKingCaptureInDirection(char** board, int x, int y, int dirX, int dirY){
-	int player = Board_getColor(board, x, y);
-	int i = 1;
-	int foundFirstEnemyInThisDirection = 0;
-	while(isInRange(x+(i+1)*dirX, y+(i+1)*dirY)){
-		int enemyNearby = Board_evalPiece(board, x+i*dirX, y+i*dirY, player)<0;
-		int enemyIsCapturable = Board_isEmpty(board, x+(i+1)*dirX, y+(i+1)*dirY);
-		if (enemyNearby && enemyIsCapturable && !foundFirstEnemyInThisDirection){
-			return Tile_new(x+(i+1)*dirX, y+(i+1)*dirY);
+ * @params: (player) - the player the check is done for
+ * @return: 1 (true) if the player has a possible move, 0 (false) otherwise
+ */
+int Board_hasPossibleMove(struct Board* board, int player){
+	uint64_t empty = emptySquares(board);
+	for (int side = 0; side <= 1; side++){
+		int forward = forwardDirection(player, side);
+		if (board->men[player] & shift(empty, 3-forward)){
+			return 1;
 		}
-		if (enemyNearby){
-			foundFirstEnemyInThisDirection = 1; // to eliminate the possibility of capturing several pieces in one jump
+	}
+	for (int direction = 0; direction < 4; direction++){
+		if (board->kings[player] & shift(empty, 3-direction)){
+			return 1;
 		}
-		i++;
 	}
-	return NULL;
+	return Board_hasPossibleJump(board, player);
 }
 
 /*
- * Checks whether a piece currently has any possible single step moves.
+ * Counts the single step moves of a player: the men's steps are the empty squares their shifted
+ * mask lands on, and each king slides along its rays up to the nearest piece.
  *
- * @params: (x,y) - the coordinates of the piece to be checked
- *			(player) - the player the check is done for
- * @return: 1 (true) if the piece has a possible single step move, 0 (false) otherwise
- */
-static int isSingleStepPossible(char** board, int x, int y, int player){
-	int forward = (player == BLACK)? -1 : 1;
-	if (Board_evalPiece(board, x, y, player) <= 0){
-		return 0;
-	} 
-	for (int sideward = -1; sideward <= 1; sideward += 2){
-		for (int k = -Board_SIZE; k <= Board_SIZE; k++){
-			if (!isInRange(x+k*sideward, y+k)){
-				continue;
-			}
-			int pieceIsKing = Board_evalPiece(board, x, y, player) == 3;
-			if (!pieceIsKing && k != forward){
-				continue;
-			}
-			if(Board_isEmpty(board, x+k*sideward, y+k)){
-				return 1;
-			}
-			if (!pieceIsKing && k == forward){
-				break;
+ * @params: (player) - the player whose moves are counted
+ * @return: the number of single step moves of the player
+ */
+static int countSingleMoves(struct Board* board, int player){
+	uint64_t empty = emptySquares(board);
+	int count = 0;
+	for (int side = 0; side <= 1; side++){
+		count += bitCount(shift(board->men[player], forwardDirection(player, side)) & empty);
+	}
+	for (uint64_t kings = board->kings[player]; kings; kings &= kings - 1){
+		int from = bitScan(kings);
+		for (int direction = 0; direction < 4; direction++){
+			uint64_t ray = rayMasks[from][direction];
+			uint64_t blockers = ray & ~empty;
+			if (blockers){
+				ray &= ~rayMasks[nearestSquare(blockers, direction)][direction] & ~blockers;
 			}
+			count += bitCount(ray);
 		}
 	}
-	return 0;
+	return count;
 }
 
 /*
- * Checks whether a piece currently has any possible jump moves.
+ * Counts the moves currently possible for a player (the player's mobility).
+ * Unless the player can capture, the moves are counted without being generated.
  *
- * @params: (x,y) - the coordinates of the piece to be checked
- *			(player) - the player the check is done for
- * @return: 1 (true) if the piece has a possible jump move, 0 (false) otherwise
+ * @params: (player) - the player whose moves are counted
+ * @return: the number of moves currently possible for the player
  */
-static int isJumpPossible(char** board, int x, int y, int player){
-	if (Board_evalPiece(board, x, y, player) <= 0){
-		return 0;
-	}
-	for (int i = -1; i <= 1; i += 2){
-		for (int j = -1; j <= 1; j += 2){
-			if (!isInRange(x+2*i,y+2*j)){
-				continue;
-			}
-			int pieceIsKing = Board_evalPiece(board, x, y, player) == 3;
-			if (pieceIsKing){
-				struct Tile* dest = canKingCaptureInDirection(board, x, y, i, j);
-				if (dest){
-					Tile_free(dest);
-					return 1;
-				}
-			}
-			int enemyNearby = Board_evalPiece(board, x+i, y+j, !player) > 0;
-			int enemyIsCapturable = Board_isEmpty(board, x+2*i, y+2*j);
-			if(enemyNearby && enemyIsCapturable){
-				return 1;
-			}
-		}
+int Board_countMoves(struct Board* board, int player){
+	if (Board_hasPossibleJump(board, player)){
+		struct MoveList moves;
+		Board_generateMoves(board, player, &moves);
+		return moves.length;
 	}
-	return 0;
+	return countSingleMoves(board, player);
 }
 
 /*
  * Evaluates the board according to the specified scoring function.
+ * The material is maintained as pieces move, so only the check for a player without moves costs anything.
  *
  * @return: a numeric evaluation of the board
  */
-int Board_getScore(char** board, int player){
-	int score = 0;
-	int hasMoves = 0;
-	int opponentHasMoves = 0;
-	for (int x = 1; x <= Board_SIZE; x++){
-		for (int y = 1; y <= Board_SIZE; y++){
-			int value = Board_evalPiece(board, x, y, player);
-			if (value == 0){
-				continue;
-			}
-			hasMoves += (value > 0) && (isSingleStepPossible(board, x, y, player) 
-					|| isJumpPossible(board, x, y, player));
-			opponentHasMoves += (value < 0) && (isSingleStepPossible(board, x, y, !player) 
-					|| isJumpPossible(board, x, y, !player));
-			score += value;
-		}
-	}
-	if (!hasMoves){
+int Board_getScore(struct Board* board, int player){
+	int score = board->material[player] - board->material[!player];
+	if (!Board_hasPossibleMove(board, player)){
 		return -100;
-	}	
-	if (!opponentHasMoves){
+	}
+	if (!Board_hasPossibleMove(board, !player)){
 		return 100;
-	}	
+	}
 	return score;
 }
 
 /*
- * Populates the list of possible jumps, recursively.
- *
- * @params: (possibleJumps) - the list to be populated
- *          (possibleMove) - the move that parts of it will be populated in the list.
- */
-static void populateJumpList(struct LinkedList* possibleJumps, struct PossibleMove* possibleMove){
-	struct Tile* lastStep = PossibleMove_getLastStep(possibleMove);
-	char** board = possibleMove->board;
-	int x = lastStep->x;
-	int y = lastStep->y;
-	
-	//checking if another jump is possible after current last jump
-	int found = 0;
-	for (int i = -1; i <= 1; i += 2){
-		for (int j = -1; j <= 1; j += 2){
-			if (!isInRange(x+i,y+j) || !isInRange(x+2*i,y+2*j)){
-				continue;
-			}
-			struct Tile* currentLastStep = PossibleMove_getLastStep(possibleMove);
-			int player = Board_getColorByTile(possibleMove->board, currentLastStep);
-			int enemyNearby = (Board_evalPiece(board, x+i, y+j, player) < 0);
-			int enemyIsCapturable = Board_isEmpty(board,x+2*i, y+2*j);
-			int justCrowned = (player == WHITE && y == Board_SIZE) || (player == BLACK && y == 1);
-			if(enemyNearby && enemyIsCapturable && !justCrowned){ //found another possible jump after current last step
-				struct PossibleMove* currentMoveClone = PossibleMove_clone(possibleMove);
-				struct LinkedList* currentSteps = currentMoveClone->steps;
-				struct Tile* extraTile = Tile_new(x+2*i, y+2*j);
-				LinkedList_add(currentSteps, extraTile);
-				
-				char oldX = currentLastStep->x;
-				int oldY = currentLastStep->y;
-				int newX = extraTile->x;
-				int newY = extraTile->y;
-				Board_move(currentMoveClone->board, oldX, oldY, newX, newY);
-				
-				populateJumpList(possibleJumps, currentMoveClone);			
-				found = 1;
-			}
+ * The state of the depth-first search for capture sequences. The jumps are carried out on a
+ * scratch copy of the occupancy, and taken back when the search backtracks, while the squares
+ * landed on are kept on a fixed stack. Only sequences with the most captures found so far are kept.
+ */
+struct CaptureSearch{
+	uint64_t empty;         /* the empty squares, as they are after the jumps on the stack */
+	uint64_t enemies;       /* the enemy pieces that can still be captured */
+	uint64_t captured;      /* the pieces captured by the jumps on the stack */
+	int from;
+	int isKing;
+	int steps[MAX_CAPTURES];
+	int numOfSteps;
+	int maxCaptures;
+	struct MoveList* moves;
+};
+
+/*
+ * Adds the sequence of jumps on the stack to the list of moves, if it captures at least as many
+ * pieces as any sequence found before. If it captures more, the shorter sequences are dropped.
+ * Sequences that take the same pieces from the same start to the same destination are the same
+ * move, so only the first of them is kept.
+ */
+static void addCaptureSequence(struct CaptureSearch* search){
+	int numOfCaptures = search->numOfSteps;
+	if (numOfCaptures < search->maxCaptures){
+		return;
+	}
+	if (numOfCaptures > search->maxCaptures){
+		MoveList_clear(search->moves);
+		search->maxCaptures = numOfCaptures;
+	}
+	int to = search->steps[search->numOfSteps-1];
+	for (int i = 0; i < search->moves->length; i++){
+		struct Move* other = &search->moves->moves[i];
+		if (other->captured == search->captured && Move_getFrom(other) == search->from && Move_getTo(other) == to){
+			return;
 		}
 	}
-	if (found){
-		PossibleMove_free(possibleMove);
-		return;
+	struct Move move;
+	Move_init(&move, search->from, search->steps[0]);
+	for (int i = 1; i < search->numOfSteps; i++){
+		Move_addJump(&move, search->steps[i], 0);
 	}
-	LinkedList_add(possibleJumps, possibleMove);	
+	move.captured = search->captured;
+	MoveList_add(search->moves, &move);
 }
 
 /*
- * Retrieves a list of all jump moves currently possible for a player.
+ * Extends the sequence of jumps on the stack in every possible way, recursively.
+ * A man jumps an adjacent enemy, and a king the nearest piece along any ray if it is an enemy,
+ * landing on any of the empty squares right behind it. The captured pieces are removed only when
+ * the move is over, so until then they block the way, but may not be jumped again. A man that
+ * passes the crowning row in the middle of a capture is not crowned, so it simply goes on.
  *
- * @params: (player) - the player whose moves are to be put in the list
- * @return: a LinkedList struct of jump moves currently possible for the player, or NULL if any allocation errors occurred
+ * @params: (square) - the square the jumping piece is on
  */
-static struct LinkedList* getPossibleJumps (char** board, int player){
-	struct LinkedList* jumpMoves = LinkedList_new(&PossibleMove_free);
-	if(jumpMoves == NULL){ //allocation failed
-		return NULL;
+static void searchCaptures(struct CaptureSearch* search, int square){
+	int found = 0;
+	for (int direction = 0; direction < 4; direction++){
+		uint64_t enemy = neighbourMasks[square][direction];
+		if (search->isKing){
+			uint64_t blockers = rayMasks[square][direction] & ~search->empty;
+			enemy = blockers? 1ULL << nearestSquare(blockers, direction) : 0;
+		}
+		if (!(enemy & search->enemies)){
+			continue;
+		}
+		const signed char* ray = rays[bitScan(enemy)][direction];
+		int length = search->isKing? BoardTables_MAX_RAY : 1;
+		for (int i = 0; i < length && ray[i] >= 0 && (search->empty & (1ULL << ray[i])); i++){
+			int landing = ray[i];
+			uint64_t moved = (1ULL << square) | (1ULL << landing);
+			search->empty ^= moved;
+			search->enemies ^= enemy;
+			search->captured ^= enemy;
+			search->steps[search->numOfSteps++] = landing;
+			searchCaptures(search, landing);
+			search->numOfSteps--;
+			search->captured ^= enemy;
+			search->enemies ^= enemy;
+			search->empty ^= moved;
+			found = 1;
+		}
 	}
-	
-	for (int x = 1; x <= Board_SIZE; x++){
-		for (int y = 1; y <= Board_SIZE; y++){			
-			if (Board_evalPiece(board, x, y, player) <= 0){
-				continue;
-			}
-			for (int i = -1; i <= 1; i += 2){
-				for (int j = -1; j <= 1; j += 2){
-					struct Tile* destTile = NULL;
-					if (!isInRange(x+i,y+j) || !isInRange(x+2*i,y+2*j)){
-						continue;
-					}
-					int pieceIsKing = Board_evalPiece(board, x, y, player) == 3;
-					if (pieceIsKing){
-						destTile = canKingCaptureInDirection(board, x, y, i, j);
-					}
-					else{
-						int enemyNearby = Board_evalPiece(board, x+i, y+j, player) < 0;
-						int enemyIsCapturable = Board_isEmpty(board, x+2*i, y+2*j);
-						if(enemyNearby && enemyIsCapturable){
-							destTile = Tile_new(x+2*i, y+2*j);
-							if (destTile == NULL){ // allocation failed
-								return NULL;
-							}
-						}
-					}
-					if (!destTile){
-						continue;
-					}
-					struct LinkedList* jumpSteps = LinkedList_new(&Tile_free);
-					if (jumpSteps == NULL){ // allocation failed
-						Tile_free(destTile);
-						return NULL;
-					}
-					LinkedList_add(jumpSteps, destTile);
-					struct PossibleMove* possibleJumpMove = PossibleMove_new(x, y, jumpSteps, board);
-					if (possibleJumpMove == NULL){ // allocation failed
-						Tile_free(destTile);
-						LinkedList_free(jumpSteps);
-						return NULL;
-					}
-					populateJumpList(jumpMoves, possibleJumpMove);
-				}
-			}
-		}	
+	if (!found && search->numOfSteps > 0){
+		addCaptureSequence(search);
 	}
-	return jumpMoves;
 }
 
 /*
- * Gets a list of all single step moves currently possible for a player.
+ * Populates a list with the jump moves currently possible for a player that capture the most pieces.
  *
  * @params: (player) - the player whose moves are to be put in the list
- * @return: a list of single step moves currently possible for the player, or NULL if any allocation errors occurred 
- */
-static struct LinkedList* getPossibleSingleMoves (char** board, int player){
-	struct LinkedList* possibleSingleMoves = LinkedList_new(&PossibleMove_free);
-	if (possibleSingleMoves == NULL){
-		return NULL;
-	}
-	int forward = (player == BLACK) ? -1 : 1; /* for each player's different direction of "forward" */
-	for (int x = 1; x <= Board_SIZE; x++){
-		for (int y = 1; y <= Board_SIZE; y++){
-			if (Board_evalPiece(board, x, y, player) <= 0){ //this tile doesn't contain one of this player's pieces
-				continue;
-			} 
-			for (int sideward = -1; sideward <= 1; sideward += 2){
-				for (int k = -Board_SIZE; k <= Board_SIZE; k++){
-					if (!isInRange(x+k*sideward, y+k)){
-						continue;
-					}	
-					int pieceIsKing = Board_evalPiece(board, x, y, player) == 3;
-					if (!pieceIsKing && k != forward){
-						continue;
-					}	
-					if(Board_isEmpty(board, x+k*sideward, y+k)){
-						struct Tile* destTile = Tile_new(x+k*sideward, y+k);
-						if (destTile == NULL){ // allocation failed
-							return NULL;
-						}
-						struct LinkedList* singleSteps = LinkedList_new(&Tile_free);
-						if (singleSteps == NULL){ // allocation failed
-							Tile_free(destTile);
-							return NULL;
-						}
-						LinkedList_add(singleSteps, destTile);
-						struct PossibleMove* possibleSingleMove = PossibleMove_new(x, y, singleSteps, board);
-						if (possibleSingleMove == NULL){ // allocation failed
-							Tile_free(destTile);
-							LinkedList_free(singleSteps);
-							return NULL;
-						}
-						LinkedList_add(possibleSingleMoves, possibleSingleMove);
-					}
-					if (!pieceIsKing && k == forward){
-						break;
-					}
-				}
-			}
-		}
+ *          (moves) - the list to be populated
+ */
+static void getPossibleJumps (struct Board* board, int player, struct MoveList* moves){
+	struct CaptureSearch search;
+	search.empty = emptySquares(board);
+	search.enemies = piecesOf(board, !player);
+	search.captured = 0;
+	search.numOfSteps = 0;
+	search.maxCaptures = 1;
+	search.moves = moves;
+	for (uint64_t pieces = piecesOf(board, player); pieces; pieces &= pieces - 1){
+		search.from = bitScan(pieces);
+		search.isKing = (board->kings[player] & (1ULL << search.from)) != 0;
+		searchCaptures(&search, search.from);
 	}
-	return possibleSingleMoves;
 }
 
 /*
- * Trims the list of possible jump moves, so it only contains moves that result in the maximum amount of captures
+ * Populates a list with all the single step moves currently possible for a player.
  *
- * @params: (jumpMovesList) - the list of all possible jump moves
- * @return: a trimmed list, or NULL if any allocation errors occurred 
- */
-static struct LinkedList* trimJumpMovesList (struct LinkedList* jumpMovesList){
-	int maxCaptures = 0;
-	
-	//finding the maximum number of captures in a currently possible jump move
-	struct Iterator iterator;
-	Iterator_init(&iterator, jumpMovesList);
-	while(Iterator_hasNext(&iterator)){ 
-		struct PossibleMove* currMove = (struct PossibleMove*)(Iterator_next(&iterator));
-		int currNumOfCaptures = PossibleMove_numOfCaptures(currMove);
-		if(currNumOfCaptures > maxCaptures){
-			maxCaptures = currNumOfCaptures;
-		}
-	}			
-	
-	//creating a new list and filling it only with the appropriate moves
-	struct LinkedList* trimmedJumpMoves = LinkedList_new(&PossibleMove_free);
-	if(trimmedJumpMoves == NULL){ // allocation failed
-		return NULL;
-	}
-	struct Iterator secondIterator;
-	Iterator_init(&secondIterator, jumpMovesList);
-	while(Iterator_hasNext(&secondIterator)){
-		struct PossibleMove* currMove = (struct PossibleMove*)(Iterator_next(&secondIterator));
-		if(PossibleMove_numOfCaptures(currMove) == maxCaptures){
-			struct PossibleMove* clonedCurrMove = PossibleMove_clone(currMove);
-			if (clonedCurrMove == NULL){ // allocation failed
-				LinkedList_free(trimmedJumpMoves);
-				return NULL;
+ * @params: (player) - the player whose moves are to be put in the list
+ *          (moves) - the list to be populated
+ */
+static void getPossibleSingleMoves (struct Board* board, int player, struct MoveList* moves){
+	uint64_t empty = emptySquares(board);
+	for (uint64_t pieces = piecesOf(board, player); pieces; pieces &= pieces - 1){
+		int from = bitScan(pieces);
+		int pieceIsKing = (board->kings[player] & (1ULL << from)) != 0;
+		for (int direction = 0; direction < 4; direction++){
+			if (!pieceIsKing && direction != forwardDirection(player, 0) && direction != forwardDirection(player, 1)){
+				continue;
+			}
+			int length = pieceIsKing? BoardTables_MAX_RAY : 1;
+			const signed char* ray = rays[from][direction];
+			for (int i = 0; i < length && ray[i] >= 0 && (empty & (1ULL << ray[i])); i++){
+				struct Move move;
+				Move_init(&move, from, ray[i]);
+				MoveList_add(moves, &move);
 			}
-			LinkedList_add(trimmedJumpMoves, clonedCurrMove);
 		}
 	}
-	LinkedList_free(jumpMovesList);
-	return trimmedJumpMoves;		
 }
 
 /*
- * Main function for getting all of the moves currently possible for a player. 
+ * Main function for generating all of the moves currently possible for a player.
  *
  * @params: (player) - the player whose moves are to be put in the list
- * @return: a list of all moves currently possible for the player, or NULL if any allocation errors occurred 
+ *          (moves) - the list to which the moves will be written
  */
-struct LinkedList* Board_getPossibleMoves(char** board, int player){
-	struct LinkedList* possibleJumpMoves = getPossibleJumps(board, player);
-	if (possibleJumpMoves == NULL){ // allocation failed
-		return NULL;
-	}
-	if (LinkedList_length(possibleJumpMoves) != 0){ /* if jumps are possible, they are the only type of move legally possible */
-		struct LinkedList* trimmedJumpMoves = trimJumpMovesList(possibleJumpMoves);
-		if(trimmedJumpMoves == NULL){ // allocation failed
-			LinkedList_free(possibleJumpMoves);
-			return NULL;
-		}
-		return trimmedJumpMoves;
-	}
-	LinkedList_free(possibleJumpMoves);
-	struct LinkedList* singleMoves = getPossibleSingleMoves(board, player);
-	if (singleMoves == NULL){ // allocation failed
-		return NULL;
+void Board_generateMoves(struct Board* board, int player, struct MoveList* moves){
+	MoveList_clear(moves);
+	getPossibleJumps(board, player, moves);
+	if (moves->length != 0){ /* if jumps are possible, they are the only type of move legally possible */
+		return;
 	}
-	
-	return singleMoves;
-}	
+	getPossibleSingleMoves(board, player, moves);
+}
 
 /*
  * Auxiliary function for printing the lines as part of printing the playing board.
@@ -687,12 +814,12 @@ static void printLine(){
 /*
  * Prints an ASCII representation of the board.
  */
-void Board_print(char** board){
+void Board_print(struct Board* board){
 	printLine();
-	for (int y = Board_SIZE-1; y >= 0 ; y--){
-		printf((y < 9? " %d": "%d"), y+1);
-		for (int x = 0; x < Board_SIZE; x++){
-			printf("| %c ", board[x][y]);
+	for (int y = Board_SIZE; y >= 1 ; y--){
+		printf((y < 10? " %d": "%d"), y);
+		for (int x = 1; x <= Board_SIZE; x++){
+			printf("| %c ", Board_getPiece(board, x, y));
 		}
 		printf("|\n");
 		printLine();
@@ -707,9 +834,6 @@ void Board_print(char** board){
 /*
  * Frees the structure.
  */
-void Board_free(char** board){
-	for(int i = 0; i < Board_SIZE; i++){
-		free(board[i]);
-	}
+void Board_free(struct Board* board){
 	free(board);
 }
\ No newline at end of file
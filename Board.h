@@ -1,5 +1,5 @@
-#include "Iterator.c"
-#include "PossibleMove.h"
+#include "MoveList.c"
+#include <stdint.h>
 
 #define Board_WHITE_MAN  'm'
 #define Board_WHITE_KING 'k'
@@ -7,38 +7,84 @@
 #define Board_BLACK_KING 'K'
 #define Board_EMPTY      ' '
 #define Board_SIZE       10
+#define Board_MAN_VALUE  1
+#define Board_KING_VALUE 3
+#define Board_FEN_LENGTH 256 /* enough for any board written by Board_writeFen */
 
+#define Board_VALID_SQUARES 0x7DFFBFF7FEFFDFULL /* all 50 playable squares, without the ghost bits */
+#define Board_ROW_1         0x1FULL
+#define Board_ROW_10        0x7C000000000000ULL
 
-char** Board_new();
+/*
+ * The 50 playable squares are packed into 64-bit masks, one bit per square.
+ * Square (x, y) is bit ((x-1) + 11*(y-1))/2, which leaves a "ghost" bit after
+ * every second row, so that the four diagonal neighbours of a square are
+ * always at a constant shift: +6 (up-right), +5 (up-left), -5 (down-right)
+ * and -6 (down-left). Both arrays are indexed by color (BLACK or WHITE).
+ */
+struct Board{
+	uint64_t men[2];
+	uint64_t kings[2];
+	uint64_t key;      /* the Zobrist hash of the pieces, maintained on every change */
+	int material[2];   /* the total value of each player's pieces, maintained on every change */
+};
 
-void Board_init      (char** board);
+/*
+ * The information needed to take back a move carried out with Board_makeMove.
+ */
+struct MoveUndo{
+	uint64_t capturedMen;
+	uint64_t capturedKings;
+	uint64_t key;
+	int material[2];
+	int promoted;
+};
 
-void Board_clear     (char** board);
 
-void Board_copy      (char** dest, char** src);
+struct Board* Board_new();
 
-void Board_setPiece(char** board, int x, int y, char piece);
+void Board_init      (struct Board* board);
 
-char Board_getPiece(char** board, int x, int y);
+void Board_clear     (struct Board* board);
 
-char Board_remove(char** board, int x, int y);
+void Board_copy      (struct Board* dest, struct Board* src);
 
-int  Board_isEmpty   (char** board, int x, int y);
+void Board_setPiece(struct Board* board, int x, int y, char piece);
 
-int  Board_isValidPosition (char** board, int x, int y);
+char Board_getPiece(struct Board* board, int x, int y);
 
-int  Board_isPlayable(char** board);
+char Board_removePiece(struct Board* board, int x, int y);
 
-void Board_update    (char** board, struct PossibleMove* move);
+int  Board_isEmpty   (struct Board* board, int x, int y);
 
-char** Board_getPossibleBoard    (char** board, struct PossibleMove* move);
+int  Board_isValidPosition (struct Board* board, int x, int y);
 
-int Board_evalPiece  (char** board, int x, int y, int color);
+int  Board_isPlayable(struct Board* board);
 
-int Board_getScore   (char** board, int color);
+int  Board_readFen   (struct Board* board, const char* fen, int* player);
 
-struct LinkedList* Board_getPossibleMoves(char** board, int player);
+int  Board_writeFen  (struct Board* board, int player, char* fen);
 
-void Board_print     (char** board);
+void Board_update    (struct Board* board, struct Move* move);
 
-void Board_free      (char** board);
\ No newline at end of file
+void Board_makeMove  (struct Board* board, struct Move* move, struct MoveUndo* undo);
+
+void Board_unmakeMove(struct Board* board, struct Move* move, struct MoveUndo* undo);
+
+uint64_t Board_getKey(struct Board* board, int player);
+
+int Board_evalPiece  (struct Board* board, int x, int y, int color);
+
+int Board_hasPossibleMove(struct Board* board, int player);
+
+int Board_hasPossibleJump(struct Board* board, int player);
+
+int Board_countMoves (struct Board* board, int player);
+
+int Board_getScore   (struct Board* board, int color);
+
+void Board_generateMoves(struct Board* board, int player, struct MoveList* moves);
+
+void Board_print     (struct Board* board);
+
+void Board_free      (struct Board* board);
\ No newline at end of file
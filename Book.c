@@ -0,0 +1,150 @@
+#include "Book.h"
+#include <string.h>
+
+/*
+ * Maps an opening book to memory.
+ *
+ * @params: (fileName) - the file of the book, as written by Book_write
+ * @return: NULL if the file could not be mapped or is not an opening book, the book otherwise
+ */
+struct Book* Book_open(const char* fileName){
+	int file = open(fileName, O_RDONLY);
+	if (file < 0){
+		return NULL;
+	}
+	struct stat status;
+	if (fstat(file, &status) != 0 || status.st_size < Book_MAGIC_LENGTH
+			|| (status.st_size - Book_MAGIC_LENGTH) % sizeof(struct BookEntry) != 0){
+		close(file);
+		return NULL;
+	}
+	void* data = mmap(NULL, status.st_size, PROT_READ, MAP_SHARED, file, 0);
+	close(file);
+	if (data == MAP_FAILED){
+		return NULL;
+	}
+	struct Book* book = (struct Book*)calloc(1, sizeof(struct Book));
+	if (!book || memcmp(data, Book_MAGIC, Book_MAGIC_LENGTH) != 0){
+		munmap(data, status.st_size);
+		free(book);
+		return NULL;
+	}
+	book->data = data;
+	book->size = status.st_size;
+	book->entries = (const struct BookEntry*)((const char*)data + Book_MAGIC_LENGTH);
+	book->numOfEntries = (status.st_size - Book_MAGIC_LENGTH) / sizeof(struct BookEntry);
+	return book;
+}
+
+/*
+ * Looks a board up in the book, and picks one of its moves at random, in proportion to their weights.
+ * The move is checked to be possible on the board, so a book that doesn't belong to the game,
+ * or a key that collides with another position's, never yields an illegal move.
+ *
+ * @params: (player) - the player to move
+ *          (random) - a random number, which decides the move
+ *          (move) - a pointer to which the move will be written
+ * @return: 1 (true) if the board was found in the book, 0 (false) otherwise
+ */
+int Book_probe(struct Book* book, struct Board* board, int player, uint64_t random, struct Move* move){
+	uint64_t key = Board_getKey(board, player);
+	long low = 0;
+	long high = book->numOfEntries;
+	while (low < high){ // the first entry whose key is not less than the board's
+		long middle = low + (high - low)/2;
+		if (book->entries[middle].key < key){
+			low = middle + 1;
+		}
+		else{
+			high = middle;
+		}
+	}
+	uint64_t totalWeight = 0;
+	long end = low;
+	for (; end < book->numOfEntries && book->entries[end].key == key; end++){
+		totalWeight += book->entries[end].weight;
+	}
+	if (totalWeight == 0){
+		return 0;
+	}
+	uint64_t choice = random % totalWeight;
+	long i = low;
+	while (choice >= book->entries[i].weight){
+		choice -= book->entries[i].weight;
+		i++;
+	}
+	struct Move bookMove = {book->entries[i].captured, book->entries[i].path};
+	struct MoveList possibleMoves;
+	Board_generateMoves(board, player, &possibleMoves);
+	for (int j = 0; j < possibleMoves.length; j++){
+		if (Move_equals(&possibleMoves.moves[j], &bookMove)){
+			*move = bookMove;
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/*
+ * Orders book entries by their keys, then by their moves.
+ */
+static int compareEntries(const void* first, const void* second){
+	const struct BookEntry* a = (const struct BookEntry*)first;
+	const struct BookEntry* b = (const struct BookEntry*)second;
+	if (a->key != b->key){
+		return (a->key < b->key)? -1 : 1;
+	}
+	if (a->path != b->path){
+		return (a->path < b->path)? -1 : 1;
+	}
+	if (a->captured != b->captured){
+		return (a->captured < b->captured)? -1 : 1;
+	}
+	return 0;
+}
+
+/*
+ * Writes an opening book. The entries are sorted, entries of the same move from the same
+ * position are merged by adding up their weights, and moves whose weight is 0 are left out.
+ *
+ * @params: (fileName) - the file to which the book is written
+ *          (entries) - the entries of the book, in any order; they are sorted and merged in place
+ *          (numOfEntries) - the number of entries
+ * @return: the number of entries written, or -1 if the file could not be written
+ */
+long Book_write(const char* fileName, struct BookEntry* entries, long numOfEntries){
+	qsort(entries, numOfEntries, sizeof(struct BookEntry), &compareEntries);
+	long numOfMerged = 0;
+	for (long i = 0; i < numOfEntries; i++){
+		if (numOfMerged > 0 && compareEntries(&entries[numOfMerged-1], &entries[i]) == 0){
+			entries[numOfMerged-1].weight += entries[i].weight;
+		}
+		else{
+			entries[numOfMerged++] = entries[i];
+		}
+	}
+	long numOfWritten = 0;
+	for (long i = 0; i < numOfMerged; i++){
+		if (entries[i].weight > 0){
+			entries[numOfWritten++] = entries[i];
+		}
+	}
+	FILE* file = fopen(fileName, "wb");
+	if (file == NULL){
+		return -1;
+	}
+	int failed = fwrite(Book_MAGIC, 1, Book_MAGIC_LENGTH, file) != Book_MAGIC_LENGTH
+			|| fwrite(entries, sizeof(struct BookEntry), numOfWritten, file) != (size_t)numOfWritten;
+	if (fclose(file) != 0 || failed){
+		return -1;
+	}
+	return numOfWritten;
+}
+
+/*
+ * Unmaps the book and frees the structure.
+ */
+void Book_free(struct Book* book){
+	munmap(book->data, book->size);
+	free(book);
+}
@@ -0,0 +1,37 @@
+#include "Perft.c"
+#include <stdio.h>
+
+#define Book_MAGIC        "DRBOOK01"
+#define Book_MAGIC_LENGTH 8
+
+/*
+ * A move of an opening book: a position, given by its key (see Board_getKey), a move from it,
+ * and the weight the move is played with. Entries are stored as they are in memory, in the byte
+ * order of the machine, so every field is a full word to leave no padding between them.
+ */
+struct BookEntry{
+	uint64_t key;
+	uint64_t captured;   /* the move, as in struct Move */
+	uint64_t path;
+	uint64_t weight;
+};
+
+/*
+ * An opening book mapped to memory, read only: Book_MAGIC, followed by the entries sorted by
+ * their keys, so that the moves of a position are found by a binary search. The keys only
+ * depend on the pieces, so the same file serves any number of processes at once.
+ */
+struct Book{
+	const struct BookEntry* entries;
+	long numOfEntries;
+	void* data;
+	size_t size;
+};
+
+struct Book* Book_open(const char* fileName);
+
+int  Book_probe(struct Book* book, struct Board* board, int player, uint64_t random, struct Move* move);
+
+long Book_write(const char* fileName, struct BookEntry* entries, long numOfEntries);
+
+void Book_free(struct Book* book);
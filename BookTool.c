@@ -0,0 +1,168 @@
+#define _POSIX_C_SOURCE 199309L /* for clock_gettime */
+#include "Game.c"
+#include <stdlib.h>
+#include <string.h>
+
+#define SELFPLAY_HASH_SIZE 16
+
+/*
+ * A standalone opening book builder. Takes the first plies of a set of games, either read
+ * from files of game records (see Game_read) or played by the computer against itself,
+ * and writes every move played in them as a book entry. A move is weighted by how its
+ * game ended for the player who made it: 2 for a win, 1 for a draw or an unfinished game,
+ * and 0 for a loss, so that moves that only ever lost are left out of the book.
+ *
+ * Usage: book <output> <plies> <records>...
+ *        book <output> <plies> --selfplay <games> <depth>
+ */
+
+/*
+ * The entries collected so far, in a growing array.
+ */
+struct Entries{
+	struct BookEntry* entries;
+	long length;
+	long capacity;
+};
+
+/*
+ * Adds the entries of the first plies of a game.
+ *
+ * @params: (plies) - the number of plies of the game to add
+ * @return: 0 on success, -1 if there is not enough memory
+ */
+static int addGame(struct Entries* entries, struct Game* game, int plies){
+	static const uint64_t weights[4][2] = { // by result, then by the player to move
+		{1, 1}, /* Game_UNFINISHED */
+		{0, 2}, /* Game_WHITE_WINS */
+		{1, 1}, /* Game_DRAW */
+		{2, 0}  /* Game_BLACK_WINS */
+	};
+	struct Board board;
+	int player = WHITE;
+	Board_init(&board);
+	for (int i = 0; i < game->numOfMoves && i < plies; i++){
+		if (entries->length == entries->capacity){
+			long capacity = (entries->capacity > 0)? 2*entries->capacity : 1024;
+			struct BookEntry* grown = (struct BookEntry*)realloc(entries->entries, capacity*sizeof(struct BookEntry));
+			if (grown == NULL){
+				return -1;
+			}
+			entries->entries = grown;
+			entries->capacity = capacity;
+		}
+		struct BookEntry* entry = &entries->entries[entries->length++];
+		entry->key = Board_getKey(&board, player);
+		entry->captured = game->moves[i].captured;
+		entry->path = game->moves[i].path;
+		entry->weight = weights[game->result][player];
+		Board_update(&board, &game->moves[i]);
+		player = !player;
+	}
+	return 0;
+}
+
+/*
+ * Adds the games of a file of game records.
+ *
+ * @return: the number of games added, or -1 if the file could not be read
+ */
+static long addRecords(struct Entries* entries, const char* fileName, int plies){
+	FILE* file = fopen(fileName, "r");
+	if (file == NULL){
+		fprintf(stderr, "Error: cannot open %s\n", fileName);
+		return -1;
+	}
+	struct Game game;
+	long numOfGames = 0;
+	int line = 0;
+	int status;
+	while ((status = Game_read(&game, file)) != 0){
+		line++;
+		if (status < 0){
+			fprintf(stderr, "Warning: %s:%d is not a valid game record, skipped\n", fileName, line);
+			continue;
+		}
+		if (addGame(entries, &game, plies) != 0){
+			fclose(file);
+			return -1;
+		}
+		numOfGames++;
+	}
+	fclose(file);
+	return numOfGames;
+}
+
+/*
+ * Adds games of the computer against itself, every one searched from scratch (see Search_clear).
+ * The games differ by the moves the search picks at random among the best.
+ *
+ * @return: the number of games added, or -1 on failure
+ */
+static long addSelfPlay(struct Entries* entries, int numOfGames, int depth, int plies){
+	struct TranspositionTable* table = TranspositionTable_new(SELFPLAY_HASH_SIZE);
+	struct Search* search = (table != NULL)? Search_new(table, 1) : NULL;
+	if (search == NULL){
+		if (table != NULL){
+			TranspositionTable_free(table);
+		}
+		return -1;
+	}
+	struct Game game;
+	long numOfAdded = 0;
+	for (int i = 0; i < numOfGames; i++){
+		Search_clear(search);
+		Game_play(&game, search, NULL, depth, 0, 0, i);
+		if (addGame(entries, &game, plies) != 0){
+			break;
+		}
+		numOfAdded++;
+	}
+	Search_free(search);
+	TranspositionTable_free(table);
+	return (numOfAdded == numOfGames)? numOfAdded : -1;
+}
+
+int main(int argc, char* argv[]){
+	int isSelfPlay = argc == 6 && strcmp(argv[3], "--selfplay") == 0;
+	if (argc < 4 || (strcmp(argv[3], "--selfplay") == 0 && !isSelfPlay)){
+		fprintf(stderr, "Usage: %s <output> <plies> <records>...\n", argv[0]);
+		fprintf(stderr, "       %s <output> <plies> --selfplay <games> <depth>\n", argv[0]);
+		return 1;
+	}
+	int plies = strtol(argv[2], NULL, 10);
+	if (plies < 1 || plies > Game_MAX_PLIES){
+		fprintf(stderr, "The number of plies should be between 1 to %d\n", Game_MAX_PLIES);
+		return 1;
+	}
+	struct Entries entries = {NULL, 0, 0};
+	long numOfGames = 0;
+	if (isSelfPlay){
+		int games = strtol(argv[4], NULL, 10);
+		int depth = strtol(argv[5], NULL, 10);
+		if (games < 1 || depth < 1 || depth > Search_MAX_DEPTH){
+			fprintf(stderr, "The number of games should be positive, and the depth between 1 to %d\n", Search_MAX_DEPTH);
+			return 1;
+		}
+		numOfGames = addSelfPlay(&entries, games, depth, plies);
+	}
+	else{
+		for (int i = 3; i < argc && numOfGames >= 0; i++){
+			long numOfAdded = addRecords(&entries, argv[i], plies);
+			numOfGames = (numOfAdded < 0)? -1 : numOfGames + numOfAdded;
+		}
+	}
+	if (numOfGames < 0){
+		fprintf(stderr, "Error: the games could not be added\n");
+		free(entries.entries);
+		return 1;
+	}
+	long numOfWritten = Book_write(argv[1], entries.entries, entries.length);
+	free(entries.entries);
+	if (numOfWritten < 0){
+		fprintf(stderr, "Error: cannot write %s\n", argv[1]);
+		return 1;
+	}
+	printf("%ld games, %ld moves, %ld book entries\n", numOfGames, entries.length, numOfWritten);
+	return 0;
+}
@@ -1,20 +1,39 @@
-#include "PossibleMoveList.c"
+#define _POSIX_C_SOURCE 199309L /* for clock_gettime */
+#include "Analysis.c"
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
 #include <regex.h>
+#include <stdarg.h>
+#include <limits.h>
 
 #define MAX_ERROR_MSG 0x1000
 #define SETTINGS 0
 #define GAME     1
-#define UNDEFINED 101
+#define DEFAULT_HASH_SIZE 16
+#define DEFAULT_TABLEBASE_DIRECTORY "tablebases"
+#define DEFAULT_BOOK "book.bin"
+#define DEFAULT_SELFPLAY_FILE         "selfplay.txt"
+#define DEFAULT_SELFPLAY_DEPTH        4
+#define DEFAULT_SELFPLAY_RANDOM_PLIES 4
+#define DEFAULT_SELFPLAY_HASH_SIZE    4
+#define DEFAULT_ANALYSIS_DEPTH        8
+#define DEFAULT_ANALYSIS_HASH_SIZE    4
+#define PROTOCOL_LINE_LENGTH          0x4000
 
-char** board;
+struct Board* board;
 int human;
 int maxRecursionDepth;
 int state;
-struct LinkedList* humanPossibleMoves;
+struct MoveList humanPossibleMoves;
 int turn;
+int startingPlayer;
+struct TranspositionTable* table;
+struct Search* search;
+int numOfThreads;
+long timePerMove;
+struct Reductions reductions;
+struct Book* book;
 
 /*
  * Compiles regular expression.
@@ -58,9 +77,27 @@ void initialize(){
 	}
 	Board_init(board);
 	human = WHITE;
+	startingPlayer = WHITE;
 	maxRecursionDepth = 1;
+	timePerMove = 0;
+	numOfThreads = 1;
+	reductions.minDepth = Search_DEFAULT_REDUCTION_DEPTH;
+	reductions.minMoves = Search_DEFAULT_REDUCTION_MOVES;
+	reductions.plies = Search_DEFAULT_REDUCTION;
+	table = TranspositionTable_new(DEFAULT_HASH_SIZE);
+	if (allocationFailed(table)){
+		exit(0);
+	}
+	search = Search_new(table, numOfThreads);
+	if (allocationFailed(search)){
+		exit(0);
+	}
+	Search_seed(search, (uint64_t)time(NULL));
+	Tablebase_open(DEFAULT_TABLEBASE_DIRECTORY);
+	book = Book_open(DEFAULT_BOOK);
+	srand(time(NULL));
 	state = SETTINGS;
-	humanPossibleMoves = NULL;
+	MoveList_clear(&humanPossibleMoves);
 	turn = human;
 }
 
@@ -69,8 +106,15 @@ void initialize(){
  */
 void freeGlobals(){
 	Board_free(board);
-	if (humanPossibleMoves != NULL){
-		LinkedList_free(humanPossibleMoves);
+	if (search != NULL){
+		Search_free(search);
+	}
+	if (table != NULL){
+		TranspositionTable_free(table);
+	}
+	Tablebase_close();
+	if (book != NULL){
+		Book_free(book);
 	}
 }
 
@@ -111,6 +155,242 @@ int setMinimaxDepth (char* str){
 	return 0;
 }
 
+/* 
+ * Sets the time the computer may spend on a move according to input from the user.
+ * When the time is set, the computer ignores the minimax depth and searches as deep
+ * as it can in the given time.
+ *
+ * @params: the input command string
+ * @return: 1 if the command didn't match, 
+ *          0 if the command matched and was executed successfully, 
+ *          17 if the user input an illegal time
+ */ 
+int setTimePerMove (char* str){
+	regex_t r; 	
+	regmatch_t matches[2];
+	char* pattern = "^time_per_move\\s+(-?[0-9]+)$";
+	long milliseconds;
+	compile_regex(&r, pattern);
+	if (regexec(&r, str, 2, matches, 0) != 0){
+		regfree(&r);
+		return 1;
+	}
+	int start = matches[1].rm_so;
+	milliseconds = strtol(str+start, NULL, 10);
+	regfree(&r);
+	if(milliseconds < 0 || milliseconds > 3600000){
+		return 17;
+	}	
+	timePerMove = milliseconds;
+	return 0;
+}
+
+/* 
+ * Sets the size of the transposition table according to input from the user.
+ *
+ * @params: the input command string
+ * @return: 1 if the command didn't match, 
+ *          0 if the command matched and was executed successfully, 
+ *          16 if the user input an illegal size,
+ *          21 if any allocation errors occurred
+ */ 
+int setHashSize (char* str){
+	regex_t r; 	
+	regmatch_t matches[2];
+	char* pattern = "^hash_size\\s+(-?[0-9]+)$";
+	int megabytes;
+	compile_regex(&r, pattern);
+	if (regexec(&r, str, 2, matches, 0) != 0){
+		regfree(&r);
+		return 1;
+	}
+	int start = matches[1].rm_so;
+	megabytes = strtol(str+start, NULL, 10);
+	regfree(&r);
+	if(megabytes < 1 || megabytes > 4096){
+		return 16;
+	}	
+	Search_free(search);
+	search = NULL;
+	TranspositionTable_free(table);
+	table = TranspositionTable_new(megabytes);
+	if (allocationFailed(table)){
+		return 21;
+	}
+	search = Search_new(table, numOfThreads);
+	if (allocationFailed(search)){
+		return 21;
+	}
+	Search_seed(search, (uint64_t)time(NULL));
+	Search_setReductions(search, reductions);
+	return 0;
+}
+
+/* 
+ * Sets the number of threads the computer searches with according to input from the user.
+ *
+ * @params: the input command string
+ * @return: 1 if the command didn't match, 
+ *          0 if the command matched and was executed successfully, 
+ *          18 if the user input an illegal number of threads,
+ *          21 if any allocation errors occurred
+ */ 
+int setThreads (char* str){
+	regex_t r; 	
+	regmatch_t matches[2];
+	char* pattern = "^threads\\s+(-?[0-9]+)$";
+	int threads;
+	compile_regex(&r, pattern);
+	if (regexec(&r, str, 2, matches, 0) != 0){
+		regfree(&r);
+		return 1;
+	}
+	int start = matches[1].rm_so;
+	threads = strtol(str+start, NULL, 10);
+	regfree(&r);
+	if(threads < 1 || threads > Search_MAX_THREADS){
+		return 18;
+	}	
+	numOfThreads = threads;
+	Search_free(search);
+	search = Search_new(table, numOfThreads);
+	if (allocationFailed(search)){
+		return 21;
+	}
+	Search_seed(search, (uint64_t)time(NULL));
+	Search_setReductions(search, reductions);
+	return 0;
+}
+
+/* 
+ * Sets the late move reductions of the computer's search according to input from the user:
+ * the least remaining depth at which moves are reduced, the number of moves searched to the
+ * full depth before the reductions start, and the depth taken off (0 turns the reductions off).
+ *
+ * @params: the input command string
+ * @return: 1 if the command didn't match, 
+ *          0 if the command matched and was executed successfully, 
+ *          20 if the user input illegal reductions
+ */ 
+int setReductions (char* str){
+	regex_t r; 	
+	regmatch_t matches[4];
+	char* pattern = "^lmr\\s+(-?[0-9]+)\\s+(-?[0-9]+)\\s+(-?[0-9]+)\\s*$";
+	compile_regex(&r, pattern);
+	if (regexec(&r, str, 4, matches, 0) != 0){
+		regfree(&r);
+		return 1;
+	}
+	int minDepth = strtol(str+matches[1].rm_so, NULL, 10);
+	int minMoves = strtol(str+matches[2].rm_so, NULL, 10);
+	int plies = strtol(str+matches[3].rm_so, NULL, 10);
+	regfree(&r);
+	if (minDepth < 1 || minDepth > Search_MAX_DEPTH || minMoves < 1 || minMoves > MoveList_CAPACITY
+			|| plies < 0 || plies > 4){
+		return 20;
+	}
+	reductions.minDepth = minDepth;
+	reductions.minMoves = minMoves;
+	reductions.plies = plies;
+	Search_setReductions(search, reductions);
+	return 0;
+}
+
+/* 
+ * Loads the endgame tablebases from a directory according to input from the user,
+ * in place of the ones loaded before, which are kept if none are found there.
+ * The tablebases are made by the tablebase tool.
+ *
+ * @params: the input command string
+ * @return: 1 if the command didn't match, 
+ *          0 if the command matched and was executed successfully, 
+ *          23 if no tablebases were found in the directory
+ */ 
+int loadTablebases (char* str){
+	regex_t r; 	
+	regmatch_t matches[2];
+	char* pattern = "^tablebases\\s+(\\S+)\\s*$";
+	compile_regex(&r, pattern);
+	if (regexec(&r, str, 2, matches, 0) != 0){
+		regfree(&r);
+		return 1;
+	}
+	str[matches[1].rm_eo] = '\0';
+	regfree(&r);
+	if (Tablebase_open(str+matches[1].rm_so) == 0){
+		return 23;
+	}
+	return 0;
+}
+
+/* 
+ * Loads an opening book according to input from the user, in place of the one loaded before.
+ * The book is made by the book tool.
+ *
+ * @params: the input command string
+ * @return: 1 if the command didn't match, 
+ *          0 if the command matched and was executed successfully, 
+ *          24 if the file could not be opened as a book
+ */ 
+int loadBook (char* str){
+	regex_t r; 	
+	regmatch_t matches[2];
+	char* pattern = "^book\\s+(\\S+)\\s*$";
+	compile_regex(&r, pattern);
+	if (regexec(&r, str, 2, matches, 0) != 0){
+		regfree(&r);
+		return 1;
+	}
+	str[matches[1].rm_eo] = '\0';
+	regfree(&r);
+	struct Book* loaded = Book_open(str+matches[1].rm_so);
+	if (loaded == NULL){
+		return 24;
+	}
+	if (book != NULL){
+		Book_free(book);
+	}
+	book = loaded;
+	return 0;
+}
+
+/* 
+ * Sets up the board according to a position in the FEN notation given by the user
+ * (see Board_readFen), in place of the pieces set before, along with the player who moves first.
+ *
+ * @params: the input command string
+ * @return: 1 if the command didn't match, 
+ *          0 if the command matched and was executed successfully, 
+ *          25 if the position is not valid
+ */ 
+int loadFen (char* str){
+	regex_t r; 	
+	regmatch_t matches[2];
+	char* pattern = "^fen\\s+(\\S+)\\s*$";
+	compile_regex(&r, pattern);
+	if (regexec(&r, str, 2, matches, 0) != 0){
+		regfree(&r);
+		return 1;
+	}
+	str[matches[1].rm_eo] = '\0';
+	regfree(&r);
+	if (!Board_readFen(board, str+matches[1].rm_so, &startingPlayer)){
+		return 25;
+	}
+	return 0;
+}
+
+/*
+ * Prints the board in the FEN notation.
+ *
+ * @params: (player) - the player to move
+ */
+void printFen(int player){
+	char fen[Board_FEN_LENGTH];
+	Board_writeFen(board, player, fen);
+	printf("%s\n", fen);
+}
+
 /* 
  * Sets the user's color according to input from the user.
  *
@@ -241,20 +521,30 @@ int setPiece(char* str){
 	return 0;
 }
 
-int populateSteps(struct LinkedList* steps, char* str){
+/*
+ * Parses the steps of a move from input from the user.
+ *
+ * @params: (move) - the move, to which the steps will be added
+ *          (from) - the square the move starts from
+ *          (str) - the steps, in the format "<x,y>[<i,j>...]"
+ * @return: 1 if the user input an illegal position on the board, 0 otherwise
+ */
+int populateSteps(struct Move* move, int from, char* str){
 	char* token = strtok(str, "><");
+	int isFirstStep = 1;
 	while (token != NULL) {
 		int x = (int)token[0]-96;
 		int y = strtol(token+2,NULL,10);
 		if (!Board_isValidPosition(board, x, y)){
-			LinkedList_free(steps);
 			return 1;
 		}
-		struct Tile* newStep = Tile_new(x,y);
-		if(allocationFailed(newStep)){
-			return -1;
+		if (isFirstStep){
+			Move_init(move, from, Move_square(x, y));
+			isFirstStep = 0;
+		}
+		else{
+			Move_addJump(move, Move_square(x, y), 0);
 		}
-		LinkedList_add(steps, newStep);
 		token = strtok(NULL, "><");
 	}	
 	return 0;
@@ -269,8 +559,7 @@ int populateSteps(struct LinkedList* steps, char* str){
  *          01 if the command didn't match,  
  *          12 if the user input an illegal position on the board,
  *          14 if the initial tile doesn't contain one of the player's pieces, 
- *          15 if the move itself is illegal, 
- *          21 if any allocation errors occurred
+ *          15 if the move itself is illegal
  */ 
 int movePiece(char* str){
 	regex_t r; 	
@@ -278,7 +567,6 @@ int movePiece(char* str){
 	int exitcode;
 	char* pattern = "^move\\s+<([a-z]),([0-9]+)>\\s+to\\s+((<[a-z],[0-9]+>)+)";
 	compile_regex(&r, pattern);
-	struct PossibleMove* move = NULL;
 	while(1){
 		if (regexec(&r, str, 5, matches, 0) != 0){
 			exitcode = 1;
@@ -298,37 +586,20 @@ int movePiece(char* str){
 		}
 		
 		//destination positions
-		struct LinkedList* steps = LinkedList_new(&Tile_free);
-		if (allocationFailed(steps)){
-			exitcode = 21;
+		struct Move move;
+		if (populateSteps(&move, Move_square(x, y), str+matches[3].rm_so)){
+			exitcode = 12;
 			break;
 		}
 		
-		int populateStepsCheck = populateSteps(steps, str+matches[3].rm_so);		
-		if (populateStepsCheck){
-			if (populateStepsCheck == 1){	
-				exitcode = 12;
-				break;
-			}
-			if (populateStepsCheck == -1){
-				exitcode = 21;
-				break;
-			}
-		}
-		
-		//constructing the move structure
-		move = PossibleMove_new(x, y, steps, board);
-		if (allocationFailed(move)){
-			exitcode = 21;
-			break;
-		}
-		//making sure move is legal
-		if (!PossibleMoveList_contains(humanPossibleMoves, move)){
+		//making sure move is legal, and finding what it captures
+		struct Move* legalMove = MoveList_find(&humanPossibleMoves, &move);
+		if (legalMove == NULL){
 			exitcode = 15;
 			break;
 		}
 		//if all preconditions are met, the move is carried out
-		Board_update(board, move);
+		Board_update(board, legalMove);
 		exitcode = 0;
 		turn = !turn;
 		Board_print(board);
@@ -336,30 +607,82 @@ int movePiece(char* str){
 	}
 	
 	regfree(&r);
-	if (move != NULL){
-		PossibleMove_free(move);
-	}
 	return exitcode;
 }
 
-/*
- * Updates the global variable (humanPossibleMoves).
+/* 
+ * Runs perft from the current board according to input from the user, and prints
+ * the number of positions under each possible move of the player to move.
  *
- * @return: 21 if any allocation errors occurred, 0 otherwise
- */
-int updatePossibleMoves(){
-	if (humanPossibleMoves){
-		LinkedList_free(humanPossibleMoves);
-		humanPossibleMoves = NULL;
+ * @params: the input command string
+ * @return: 01 if the command didn't match, 
+ *          00 if the command matched and was executed successfully, 
+ *          19 if the user input an illegal depth
+ */ 
+int runPerft(char* str){
+	regex_t r; 	
+	regmatch_t matches[2];
+	char* pattern = "^perft\\s+(-?[0-9]+)\\s*$";
+	compile_regex(&r, pattern);
+	if (regexec(&r, str, 2, matches, 0) != 0){
+		regfree(&r);
+		return 1;
 	}
-	
-	humanPossibleMoves = Board_getPossibleMoves(board, human);
-	if (allocationFailed(humanPossibleMoves)){
-		return 21;
+	int depth = strtol(str+matches[1].rm_so, NULL, 10);
+	regfree(&r);
+	if (depth < 1 || depth > 20){
+		return 19;
 	}
+	int player = (state == GAME)? turn : startingPlayer;
+	Perft_divide(board, player, depth);
 	return 0;
 }
 
+/* 
+ * Searches the current board for the best lines of the player to move according to input
+ * from the user, with the computer's depth or time per move, and prints each line with its score.
+ *
+ * @params: the input command string
+ * @return: 01 if the command didn't match, 
+ *          00 if the command matched and was executed successfully, 
+ *          22 if the user input an illegal number of lines
+ */ 
+int runMultiPV(char* str){
+	regex_t r; 	
+	regmatch_t matches[2];
+	char* pattern = "^multipv\\s+(-?[0-9]+)\\s*$";
+	compile_regex(&r, pattern);
+	if (regexec(&r, str, 2, matches, 0) != 0){
+		regfree(&r);
+		return 1;
+	}
+	int numOfLines = strtol(str+matches[1].rm_so, NULL, 10);
+	regfree(&r);
+	if (numOfLines < 1 || numOfLines > MoveList_CAPACITY){
+		return 22;
+	}
+	int player = (state == GAME)? turn : startingPlayer;
+	int maxDepth = (timePerMove > 0)? Search_MAX_DEPTH : maxRecursionDepth;
+	struct PrincipalVariation lines[numOfLines];
+	numOfLines = Search_multiPV(search, board, player, numOfLines, maxDepth, timePerMove, lines);
+	for (int i = 0; i < numOfLines; i++){
+		printf("%d. score %d:", i+1, lines[i].score);
+		for (int j = 0; j < lines[i].length; j++){
+			printf((j == 0)? " " : ", ");
+			Move_print(&lines[i].moves[j]);
+		}
+		printf("\n");
+	}
+	return 0;
+}
+
+/*
+ * Updates the global variable (humanPossibleMoves).
+ */
+void updatePossibleMoves(){
+	Board_generateMoves(board, human, &humanPossibleMoves);
+}
+
 
 /*
  * Populates a command string to a pointer read from the user.
@@ -394,11 +717,16 @@ int executeCommand(char* command){
 			Board_print(board);
 			return 0;
 		}
+		if (strcmp(command, "fen") == 0){
+			printFen(startingPlayer);
+			return 0;
+		}
 		if (strcmp(command, "start") == 0){
 			if (Board_isPlayable(board)){
 				state = GAME;
-				turn = WHITE;
-				return updatePossibleMoves();
+				turn = startingPlayer;
+				updatePossibleMoves();
+				return 0;
 			}
 			return 13;
 		}		
@@ -406,6 +734,42 @@ int executeCommand(char* command){
 		if(error != 1){
 			return error;
 		}	
+		error = setTimePerMove(command);
+		if(error != 1){
+			return error;
+		}
+		error = runPerft(command);
+		if(error != 1){
+			return error;
+		}
+		error = runMultiPV(command);
+		if(error != 1){
+			return error;
+		}
+		error = setThreads(command);
+		if(error != 1){
+			return error;
+		}
+		error = setHashSize(command);
+		if(error != 1){
+			return error;
+		}
+		error = setReductions(command);
+		if(error != 1){
+			return error;
+		}
+		error = loadTablebases(command);
+		if(error != 1){
+			return error;
+		}
+		error = loadBook(command);
+		if(error != 1){
+			return error;
+		}
+		error = loadFen(command);
+		if(error != 1){
+			return error;
+		}
 		error = setUserColor(command);
 		if(error != 1){
 			return error;
@@ -421,7 +785,11 @@ int executeCommand(char* command){
 	}
 	else{
 		if (strcmp(command, "get_moves") == 0){
-			PossibleMoveList_print(humanPossibleMoves);
+			MoveList_print(&humanPossibleMoves);
+			return 0;
+		}
+		if (strcmp(command, "fen") == 0){
+			printFen(turn);
 			return 0;
 		}
 		
@@ -429,6 +797,15 @@ int executeCommand(char* command){
 			freeAndExit();
 		}
 		
+		error = runPerft(command);
+		if(error != 1){
+			return error;
+		}
+		error = runMultiPV(command);
+		if(error != 1){
+			return error;
+		}
+		
 		error = movePiece(command);
 		if(error != 1){
 			return error;
@@ -464,6 +841,34 @@ void printError(int error){
 		case(15):
 			printf("Illegal move\n");
 			break;
+		case(17):
+			printf("Wrong value for time per move. The value should be between 0 (no limit) to 3600000 milliseconds\n");
+			break;
+		case(18):
+			printf("Wrong value for threads. The value should be between 1 to %d\n", Search_MAX_THREADS);
+			break;
+		case(19):
+			printf("Wrong value for perft depth. The value should be between 1 to 20\n");
+			break;
+		case(16):
+			printf("Wrong value for hash size. The value should be between 1 to 4096 megabytes\n");
+			break;
+		case(20):
+			printf("Wrong value for lmr. The depth should be between 1 to %d, the moves between 1 to %d and the reduction between 0 to 4\n",
+					Search_MAX_DEPTH, MoveList_CAPACITY);
+			break;
+		case(22):
+			printf("Wrong value for multipv. The value should be between 1 to %d\n", MoveList_CAPACITY);
+			break;
+		case(23):
+			printf("No tablebases were found in the directory\n");
+			break;
+		case(24):
+			printf("The opening book could not be opened\n");
+			break;
+		case(25):
+			printf("Invalid position. The position should be in the FEN notation, e.g. W:W31-50:B1-20\n");
+			break;
 		case(21):
 			freeAndExit();
 		default:
@@ -472,62 +877,21 @@ void printError(int error){
 	}
 }
 
-/*
- * The minimax AI algorithm.
- */
-struct PossibleMove* minimax(struct PossibleMove* possibleMove, int depth, int player){
-	if (depth == 0){
-		return possibleMove;
-	}
-	char** board = possibleMove->board;
-	struct LinkedList* possibleMoves = Board_getPossibleMoves(board, player);
-	if (LinkedList_length(possibleMoves) == 0){
-		LinkedList_free(possibleMoves);
-		return possibleMove;
-	}
-	if (LinkedList_length(possibleMoves) == 1){
-		struct PossibleMove* onlyMove = PossibleMoveList_first(possibleMoves);
-		LinkedList_freeAllButOne(possibleMoves, onlyMove);
-		return onlyMove;
-	}
-	
-	struct PossibleMove* bestPossibleMove;
-	int extremum = UNDEFINED;
-	struct Iterator iterator;
-	Iterator_init(&iterator, possibleMoves);
-	while (Iterator_hasNext(&iterator)) {
-		struct PossibleMove* currentPossibleMove = (struct PossibleMove*)Iterator_next(&iterator);
-		struct PossibleMove* temp = minimax(currentPossibleMove, depth-1, player);
-		int score = Board_getScore(temp->board, player);
-		if (currentPossibleMove != temp){
-			PossibleMove_free(temp);
-		}		
-		if (extremum == UNDEFINED || 
-				(player != human && score >  extremum) || 
-				(player == human && score <  extremum) || 
-				(rand()%2       && score == extremum)
-			){
-			extremum = score;
-			bestPossibleMove = currentPossibleMove;
-		}
-	}
-	LinkedList_freeAllButOne(possibleMoves, bestPossibleMove);
-	return bestPossibleMove;
-}
-
 /*
  * The computer turn procedure.
  */
 void computerTurn(){
-	struct PossibleMove possibleMove;
-	possibleMove.board = board;
-	struct PossibleMove* bestMove = minimax(&possibleMove, maxRecursionDepth, !human);
+	struct Move bestMove;
+	uint64_t random = ((uint64_t)rand() << 31) ^ (uint64_t)rand();
+	if (book == NULL || !Book_probe(book, board, !human, random, &bestMove)){
+		int maxDepth = (timePerMove > 0)? Search_MAX_DEPTH : maxRecursionDepth;
+		bestMove = Search_bestMove(search, board, !human, maxDepth, timePerMove);
+	}
 	printf("Computer: ");
-	PossibleMove_print(bestMove);
+	Move_print(&bestMove);
 	printf("\n");
-	Board_update(board, bestMove);
-	PossibleMove_free(bestMove);
-	printError(updatePossibleMoves());
+	Board_update(board, &bestMove);
+	updatePossibleMoves();
 	turn = !turn;
 	Board_print(board);
 }
@@ -547,7 +911,460 @@ void humanTurn(){
 	}
 }
 
-int main(){
+/*
+ * The state of the engine protocol mode.
+ */
+int protocolPlayer;                 /* the player to move on the board */
+pthread_t protocolSearchThread;
+int isProtocolSearching;            /* 1 while a search started by "go" hasn't been waited for */
+int protocolMaxDepth;
+long protocolTimePerMove;
+long protocolStartTime;
+pthread_mutex_t protocolOutputLock = PTHREAD_MUTEX_INITIALIZER;
+
+/*
+ * Writes a line of the engine protocol to the standard output, at once and as a whole,
+ * since the searching thread writes its lines while the commands are being read.
+ */
+void protocolPrint(const char* format, ...){
+	va_list args;
+	va_start(args, format);
+	pthread_mutex_lock(&protocolOutputLock);
+	vprintf(format, args);
+	fflush(stdout);
+	pthread_mutex_unlock(&protocolOutputLock);
+	va_end(args);
+}
+
+/*
+ * Reports an iteration of the search as an "info" line.
+ */
+void reportIteration(struct Search* search, int depth, int score, struct PrincipalVariation* line){
+	long time = Search_currentTimeMillis() - protocolStartTime;
+	long nodes = Search_nodes(search);
+	long nodesPerSecond = (time > 0)? nodes * 1000 / time : nodes * 1000;
+	char pv[Search_MAX_PV_LENGTH * Move_STRING_LENGTH + 1];
+	int length = 0;
+	for (int i = 0; i < line->length; i++){
+		length += Move_toString(&line->moves[i], pv+length);
+		pv[length++] = ' ';
+	}
+	pv[(length > 0)? length-1 : 0] = '\0';
+	protocolPrint("info depth %d score %d nodes %ld nps %ld time %ld pv %s\n", depth, score, nodes, nodesPerSecond, time, pv);
+}
+
+/*
+ * The searching thread of "go": searches the board and replies with the best move.
+ */
+void* runProtocolSearch(void* arg){
+	struct Move bestMove = Search_bestMove(search, board, protocolPlayer, protocolMaxDepth, protocolTimePerMove);
+	char str[Move_STRING_LENGTH];
+	Move_toString(&bestMove, str);
+	protocolPrint("bestmove %s\n", str);
+	return NULL;
+}
+
+/*
+ * Stops the search started by "go", if there is one, and waits for it to reply.
+ */
+void stopProtocolSearch(){
+	if (!isProtocolSearching){
+		return;
+	}
+	Search_stop(search);
+	pthread_join(protocolSearchThread, NULL);
+	isProtocolSearching = 0;
+}
+
+/*
+ * Sets up the board for "position": "startpos" or "fen <fen>", optionally followed by "moves"
+ * and the moves played from there in the standard notation. The board is left as it was if
+ * the position or any of the moves isn't valid.
+ *
+ * @params: (args) - the command, after "position"
+ * @return: 1 (true) if the position was set up, 0 (false) otherwise
+ */
+int setProtocolPosition(char* args){
+	struct Board position;
+	int player = WHITE;
+	char* moves = strstr(args, " moves");
+	if (moves != NULL){
+		*moves = '\0';
+		moves += strlen(" moves");
+	}
+	while (*args == ' '){
+		args++;
+	}
+	if (strncmp(args, "startpos", 8) == 0 && (args[8] == '\0' || args[8] == ' ')){
+		Board_init(&position);
+	}
+	else if (strncmp(args, "fen ", 4) != 0 || !Board_readFen(&position, args+4, &player)){
+		return 0;
+	}
+	for (char* token = (moves != NULL)? strtok(moves, " ") : NULL; token != NULL; token = strtok(NULL, " ")){
+		struct MoveList possibleMoves;
+		Board_generateMoves(&position, player, &possibleMoves);
+		struct Move* move = MoveList_parse(&possibleMoves, token);
+		if (move == NULL){
+			return 0;
+		}
+		Board_update(&position, move);
+		player = !player;
+	}
+	Board_copy(board, &position);
+	protocolPlayer = player;
+	return 1;
+}
+
+/*
+ * Starts a search for "go", with the limits "depth <plies>", "movetime <milliseconds>" or "infinite";
+ * without a limit, the search is limited as in the game, by the minimax depth and the time per move.
+ *
+ * @params: (args) - the command, after "go"
+ * @return: 1 (true) if the search was started or a reply was given, 0 (false) if the limits aren't valid
+ */
+int startProtocolSearch(char* args){
+	int maxDepth = (timePerMove > 0)? Search_MAX_DEPTH : maxRecursionDepth;
+	long time = timePerMove;
+	for (char* token = strtok(args, " "); token != NULL; token = strtok(NULL, " ")){
+		if (strcmp(token, "infinite") == 0){
+			maxDepth = Search_MAX_DEPTH;
+			time = 0;
+			continue;
+		}
+		char* value = strtok(NULL, " ");
+		if (value == NULL){
+			return 0;
+		}
+		if (strcmp(token, "depth") == 0){
+			maxDepth = strtol(value, NULL, 10);
+			time = 0;
+		}
+		else if (strcmp(token, "movetime") == 0){
+			time = strtol(value, NULL, 10);
+			maxDepth = Search_MAX_DEPTH;
+		}
+		else{
+			return 0;
+		}
+	}
+	if (maxDepth < 1 || maxDepth > Search_MAX_DEPTH || time < 0){
+		return 0;
+	}
+	if (!Board_hasPossibleMove(board, protocolPlayer)){
+		protocolPrint("bestmove none\n");
+		return 1;
+	}
+	protocolMaxDepth = maxDepth;
+	protocolTimePerMove = time;
+	protocolStartTime = Search_currentTimeMillis();
+	Search_resetStop(search);
+	search->report = &reportIteration;
+	if (pthread_create(&protocolSearchThread, NULL, &runProtocolSearch, NULL) != 0){
+		runProtocolSearch(NULL);
+		return 1;
+	}
+	isProtocolSearching = 1;
+	return 1;
+}
+
+/*
+ * Runs the engine protocol over the standard input and output, for tournament managers
+ * and other programs. Commands are read one per line, and are answered as follows:
+ *   isready                     - "readyok", also while searching
+ *   newgame                     - forgets the previous searches and sets up the initial position
+ *   position startpos|fen <fen> [moves <move>...] - sets up a position (see Board_readFen)
+ *   go [depth <plies>] [movetime <milliseconds>] [infinite] - starts searching; an "info" line
+ *                                 is written for every completed depth, and "bestmove <move>" at the end
+ *   stop                        - ends the search, which then writes its "bestmove" at once
+ *   fen                         - "fen <fen>" of the board (see Board_writeFen)
+ *   quit                        - ends the program
+ * The settings of the game (threads, hash_size, lmr, tablebases, minimax_depth and time_per_move)
+ * are accepted as well. Any command other than isready stops the search first, if it is still running.
+ * Invalid commands are answered with an "error" line.
+ *
+ * @return: the exit code of the program
+ */
+int runProtocol(){
+	initialize();
+	protocolPlayer = WHITE;
+	isProtocolSearching = 0;
+	protocolPrint("id name Draughts\n");
+	char line[PROTOCOL_LINE_LENGTH];
+	while (fgets(line, sizeof(line), stdin) != NULL){
+		line[strcspn(line, "\r\n")] = '\0';
+		char* command = line;
+		while (*command == ' '){
+			command++;
+		}
+		if (*command == '\0'){
+			continue;
+		}
+		if (strcmp(command, "isready") == 0){
+			protocolPrint("readyok\n");
+			continue;
+		}
+		stopProtocolSearch();
+		char original[PROTOCOL_LINE_LENGTH]; // the handlers may cut the command while parsing it
+		strcpy(original, command);
+		int isValid = 1;
+		if (strcmp(command, "quit") == 0){
+			break;
+		}
+		else if (strcmp(command, "stop") == 0){
+			continue; // the search, if any, was stopped above
+		}
+		else if (strcmp(command, "fen") == 0){
+			char fen[Board_FEN_LENGTH];
+			Board_writeFen(board, protocolPlayer, fen);
+			protocolPrint("fen %s\n", fen);
+		}
+		else if (strcmp(command, "newgame") == 0){
+			Search_clear(search);
+			Board_init(board);
+			protocolPlayer = WHITE;
+		}
+		else if (strncmp(command, "position ", 9) == 0){
+			isValid = setProtocolPosition(command+9);
+		}
+		else if (strcmp(command, "go") == 0 || strncmp(command, "go ", 3) == 0){
+			isValid = startProtocolSearch(command+2);
+		}
+		else{
+			int error = setThreads(command);
+			error = (error == 1)? setHashSize(command) : error;
+			error = (error == 1)? setReductions(command) : error;
+			error = (error == 1)? loadTablebases(command) : error;
+			error = (error == 1)? setMinimaxDepth(command) : error;
+			error = (error == 1)? setTimePerMove(command) : error;
+			if (error == 21){
+				freeAndExit();
+			}
+			isValid = (error == 0);
+		}
+		if (!isValid){
+			protocolPrint("error %s\n", original);
+		}
+	}
+	stopProtocolSearch();
+	freeGlobals();
+	return 0;
+}
+
+/*
+ * An option of the command line, "--<name> <value>": either a number within a range,
+ * or a string, such as a file name.
+ */
+struct Option{
+	const char* name;
+	long min;
+	long max;
+	long* number;           /* where the value of a number is written, NULL for a string */
+	const char** string;    /* where the value of a string is written, NULL for a number */
+};
+
+/*
+ * Parses the options of the command line into their values. Options that aren't given keep
+ * the values they had, and an error is printed for the first one that isn't valid.
+ *
+ * @params: (argc, argv) - the command line
+ *          (options) - the options the command line may have
+ * @return: 1 (true) if all the options are known and their values are valid, 0 (false) otherwise
+ */
+int parseOptions(int argc, char* argv[], struct Option options[], int numOfOptions){
+	for (int i = 1; i < argc; i += 2){
+		struct Option* option = NULL;
+		for (int j = 0; j < numOfOptions; j++){
+			if (strcmp(argv[i], options[j].name) == 0){
+				option = &options[j];
+			}
+		}
+		if (option == NULL){
+			fprintf(stderr, "Wrong option: %s\n", argv[i]);
+			return 0;
+		}
+		if (i+1 == argc){
+			fprintf(stderr, "Missing value for %s\n", argv[i]);
+			return 0;
+		}
+		if (option->string != NULL){
+			*option->string = argv[i+1];
+			continue;
+		}
+		char* end;
+		long number = strtol(argv[i+1], &end, 10);
+		if (*end != '\0' || number < option->min || number > option->max){
+			fprintf(stderr, "Wrong value for %s: %s\n", argv[i], argv[i+1]);
+			return 0;
+		}
+		*option->number = number;
+	}
+	return 1;
+}
+
+/*
+ * Prints the usage of the command line.
+ */
+void printUsage(char* program){
+	fprintf(stderr, "Usage: %s\n", program);
+	fprintf(stderr, "       %s --protocol\n", program);
+	fprintf(stderr, "       %s --analyse <positions> [--threads <threads>] [--depth <depth>] [--time <milliseconds>]\n", program);
+	fprintf(stderr, "          [--hash <megabytes>] [--output <file>]\n");
+	fprintf(stderr, "       %s --selfplay <games> [--threads <threads>] [--depth <depth>] [--time <milliseconds>]\n", program);
+	fprintf(stderr, "          [--random <plies>] [--hash <megabytes>] [--seed <seed>] [--book <file>] [--output <file>]\n");
+}
+
+/*
+ * Plays games of the computer against itself, without any interaction, according to the command line.
+ * The records of the games are written to the output file (see Game_write), and a summary
+ * of the results to the standard output.
+ *
+ * @params: (argc, argv) - the command line
+ * @return: the exit code of the program
+ */
+int runSelfPlay(int argc, char* argv[]){
+	struct SelfPlay selfPlay;
+	long games = 0, threads = 1, depth = DEFAULT_SELFPLAY_DEPTH, time = 0;
+	long randomPlies = DEFAULT_SELFPLAY_RANDOM_PLIES, hashSize = DEFAULT_SELFPLAY_HASH_SIZE, seed = 0;
+	const char* output = DEFAULT_SELFPLAY_FILE;
+	const char* bookFile = NULL;
+	struct Option options[] = {
+		{"--selfplay", 1, LONG_MAX, &games, NULL},
+		{"--threads", 1, WorkerPool_MAX_THREADS, &threads, NULL},
+		{"--depth", 1, Search_MAX_DEPTH, &depth, NULL},
+		{"--time", 0, 3600000, &time, NULL},
+		{"--random", 0, Game_MAX_PLIES, &randomPlies, NULL},
+		{"--hash", 1, 4096, &hashSize, NULL},
+		{"--seed", 0, LONG_MAX, &seed, NULL},
+		{"--book", 0, 0, NULL, &bookFile},
+		{"--output", 0, 0, NULL, &output}
+	};
+	if (!parseOptions(argc, argv, options, sizeof(options)/sizeof(options[0])) || games == 0){
+		printUsage(argv[0]);
+		return 1;
+	}
+	selfPlay.numOfGames = games;
+	selfPlay.maxDepth = depth;
+	selfPlay.timePerMove = time;
+	selfPlay.numOfRandomPlies = randomPlies;
+	selfPlay.hashSize = hashSize;
+	selfPlay.seed = seed;
+	selfPlay.book = NULL;
+	if (selfPlay.timePerMove > 0){
+		selfPlay.maxDepth = Search_MAX_DEPTH;
+	}
+	if (bookFile != NULL){
+		selfPlay.book = Book_open(bookFile);
+		if (selfPlay.book == NULL){
+			fprintf(stderr, "Error: the opening book %s could not be opened\n", bookFile);
+			return 1;
+		}
+	}
+	selfPlay.file = fopen(output, "w");
+	if (selfPlay.file == NULL){
+		fprintf(stderr, "Error: cannot open %s\n", output);
+		if (selfPlay.book != NULL){
+			Book_free(selfPlay.book);
+		}
+		return 1;
+	}
+	Tablebase_open(DEFAULT_TABLEBASE_DIRECTORY);
+	long startTime = Search_currentTimeMillis();
+	long numOfPlayed = SelfPlay_run(&selfPlay, threads);
+	long elapsed = Search_currentTimeMillis() - startTime;
+	int failed = fclose(selfPlay.file) != 0 || numOfPlayed < 0;
+	Tablebase_close();
+	if (selfPlay.book != NULL){
+		Book_free(selfPlay.book);
+	}
+	if (failed){
+		fprintf(stderr, "Error: the games could not be played\n");
+		return 1;
+	}
+	printf("%ld games: %ld white wins, %ld draws, %ld black wins, %ld unfinished\n", numOfPlayed,
+			selfPlay.results[Game_WHITE_WINS], selfPlay.results[Game_DRAW], selfPlay.results[Game_BLACK_WINS],
+			selfPlay.results[Game_UNFINISHED]);
+	printf("Time: %ld ms\n", elapsed);
+	return 0;
+}
+
+/*
+ * Analyses a file of positions, one FEN per line, without any interaction, according to the command line.
+ * The results are written to the output file (see struct Analysis), or to the standard output,
+ * and a summary to the standard error. A file name of "-" reads the positions from the standard input.
+ *
+ * @params: (argc, argv) - the command line
+ * @return: the exit code of the program
+ */
+int runAnalysis(int argc, char* argv[]){
+	struct Analysis analysis;
+	long threads = 1, depth = DEFAULT_ANALYSIS_DEPTH, time = 0, hashSize = DEFAULT_ANALYSIS_HASH_SIZE;
+	const char* inputFile = NULL;
+	const char* outputFile = NULL;
+	struct Option options[] = {
+		{"--analyse", 0, 0, NULL, &inputFile},
+		{"--threads", 1, WorkerPool_MAX_THREADS, &threads, NULL},
+		{"--depth", 1, Search_MAX_DEPTH, &depth, NULL},
+		{"--time", 0, 3600000, &time, NULL},
+		{"--hash", 1, 4096, &hashSize, NULL},
+		{"--output", 0, 0, NULL, &outputFile}
+	};
+	if (!parseOptions(argc, argv, options, sizeof(options)/sizeof(options[0])) || inputFile == NULL){
+		printUsage(argv[0]);
+		return 1;
+	}
+	analysis.maxDepth = depth;
+	analysis.timePerMove = time;
+	analysis.hashSize = hashSize;
+	if (analysis.timePerMove > 0){
+		analysis.maxDepth = Search_MAX_DEPTH;
+	}
+	analysis.input = (strcmp(inputFile, "-") == 0)? stdin : fopen(inputFile, "r");
+	if (analysis.input == NULL){
+		fprintf(stderr, "Error: cannot open %s\n", inputFile);
+		return 1;
+	}
+	analysis.output = (outputFile == NULL)? stdout : fopen(outputFile, "w");
+	if (analysis.output == NULL){
+		fprintf(stderr, "Error: cannot open %s\n", outputFile);
+		fclose(analysis.input);
+		return 1;
+	}
+	Tablebase_open(DEFAULT_TABLEBASE_DIRECTORY);
+	long startTime = Search_currentTimeMillis();
+	long numOfAnalysed = Analysis_run(&analysis, threads);
+	long elapsed = Search_currentTimeMillis() - startTime;
+	int failed = numOfAnalysed < 0 || ferror(analysis.output);
+	if (analysis.input != stdin){
+		fclose(analysis.input);
+	}
+	if (analysis.output != stdout){
+		failed |= fclose(analysis.output) != 0;
+	}
+	Tablebase_close();
+	if (failed){
+		fprintf(stderr, "Error: the positions could not be analysed\n");
+		return 1;
+	}
+	fprintf(stderr, "%ld positions, %ld invalid, %ld nodes\n", analysis.numOfPositions, analysis.numOfErrors, analysis.nodes);
+	fprintf(stderr, "Time: %ld ms\n", elapsed);
+	return 0;
+}
+
+int main(int argc, char* argv[]){
+	if (argc == 2 && strcmp(argv[1], "--protocol") == 0){
+		return runProtocol();
+	}
+	if (argc > 1 && strcmp(argv[1], "--analyse") == 0){
+		return runAnalysis(argc, argv);
+	}
+	if (argc > 1 && strcmp(argv[1], "--selfplay") == 0){
+		return runSelfPlay(argc, argv);
+	}
+	if (argc > 1){
+		printUsage(argv[0]);
+		return 1;
+	}
 	initialize();
 	printf("Welcome to Draughts!\n");
 	printf("Enter game settings:\n");
@@ -560,7 +1377,7 @@ int main(){
 			computerTurn();	
 		}
 		
-		gameOver = (Board_getScore(board, turn) == -100);
+		gameOver = !Board_hasPossibleMove(board, turn);
 	}
 	printf("%s player wins!\n", (turn == BLACK)? "White" : "Black");
 	freeGlobals();
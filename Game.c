@@ -0,0 +1,104 @@
+#include "Game.h"
+#include <string.h>
+
+/*
+ * Plays a game of the computer against itself, from the standard initial position.
+ * All of the randomness of the game comes from the seed, so a game played by a single
+ * thread to a fixed depth is played the same way again with the same seed.
+ *
+ * @params: (search) - the search both players use
+ *          (book) - the opening book both players use, or NULL to always search
+ *          (maxDepth) - the depth of the search
+ *          (timePerMove) - the time limit of the search in milliseconds, or 0 for no limit
+ *          (numOfRandomPlies) - the number of plies at the start of the game that are played at random
+ *          (seed) - the seed of the random numbers
+ * @return: the result of the game
+ */
+int Game_play(struct Game* game, struct Search* search, struct Book* book, int maxDepth, long timePerMove,
+		int numOfRandomPlies, uint64_t seed){
+	struct Board board;
+	struct MoveList possibleMoves;
+	uint64_t randomState = 0x9E3779B97F4A7C15ULL * (seed + 1);
+	int player = WHITE;
+	Board_init(&board);
+	Search_seed(search, seed);
+	game->numOfMoves = 0;
+	game->result = Game_UNFINISHED;
+	while (game->result == Game_UNFINISHED){
+		Board_generateMoves(&board, player, &possibleMoves);
+		if (possibleMoves.length == 0){
+			game->result = (player == WHITE)? Game_BLACK_WINS : Game_WHITE_WINS;
+			break;
+		}
+		if (game->numOfMoves == Game_MAX_PLIES){
+			game->result = Game_DRAW;
+			break;
+		}
+		struct Move move;
+		if (game->numOfMoves < numOfRandomPlies){
+			move = possibleMoves.moves[xorshift(&randomState) % possibleMoves.length];
+		}
+		else if (book == NULL || !Book_probe(book, &board, player, xorshift(&randomState), &move)){
+			move = Search_bestMove(search, &board, player, maxDepth, timePerMove);
+		}
+		game->moves[game->numOfMoves++] = move;
+		Board_update(&board, &move);
+		player = !player;
+	}
+	return game->result;
+}
+
+/*
+ * Writes the record of a game, as a single line.
+ */
+void Game_write(struct Game* game, FILE* file){
+	static const char* results[] = {"*", "2-0", "1-1", "0-2"};
+	char str[Move_STRING_LENGTH];
+	for (int i = 0; i < game->numOfMoves; i++){
+		Move_toString(&game->moves[i], str);
+		fprintf(file, "%s ", str);
+	}
+	fprintf(file, "%s\n", results[game->result]);
+}
+
+/*
+ * Reads the record of a game from the next line of a file, and checks that its moves are possible.
+ * Tokens that end with a period, the move numbers of the portable game notation, are skipped.
+ *
+ * @params: (game) - the game the record is read into
+ * @return: 1 if a game was read, 0 at the end of the file, -1 if the line is not a valid record
+ */
+int Game_read(struct Game* game, FILE* file){
+	static const char* results[] = {"*", "2-0", "1-1", "0-2"};
+	char line[Game_LINE_LENGTH];
+	if (fgets(line, sizeof(line), file) == NULL){
+		return 0;
+	}
+	struct Board board;
+	struct MoveList possibleMoves;
+	int player = WHITE;
+	Board_init(&board);
+	game->numOfMoves = 0;
+	game->result = Game_UNFINISHED;
+	for (char* token = strtok(line, " \t\r\n"); token != NULL; token = strtok(NULL, " \t\r\n")){
+		int isResult = 0;
+		for (int result = 0; result < 4; result++){
+			if (strcmp(token, results[result]) == 0){
+				game->result = result;
+				isResult = 1;
+			}
+		}
+		if (isResult || token[strlen(token)-1] == '.'){
+			continue;
+		}
+		Board_generateMoves(&board, player, &possibleMoves);
+		struct Move* move = MoveList_parse(&possibleMoves, token);
+		if (move == NULL || game->numOfMoves == Game_MAX_PLIES){
+			return -1;
+		}
+		game->moves[game->numOfMoves++] = *move;
+		Board_update(&board, move);
+		player = !player;
+	}
+	return 1;
+}
@@ -0,0 +1,28 @@
+#include "Book.c"
+
+#define Game_MAX_PLIES   300 /* a game that lasts longer is a draw */
+#define Game_LINE_LENGTH (Game_MAX_PLIES*Move_STRING_LENGTH + 16)
+
+#define Game_UNFINISHED  0
+#define Game_WHITE_WINS  1
+#define Game_DRAW        2
+#define Game_BLACK_WINS  3
+
+/*
+ * A game from the standard initial position, white moving first, as a list of its moves.
+ * A game record is a line of text: the moves in the standard notation (see Move_toString),
+ * separated by spaces, followed by the result: "2-0" if white won, "0-2" if black won,
+ * "1-1" for a draw, or "*" for an unfinished game.
+ */
+struct Game{
+	struct Move moves[Game_MAX_PLIES];
+	int numOfMoves;
+	int result;
+};
+
+int  Game_play (struct Game* game, struct Search* search, struct Book* book, int maxDepth, long timePerMove,
+		int numOfRandomPlies, uint64_t seed);
+
+void Game_write(struct Game* game, FILE* file);
+
+int  Game_read (struct Game* game, FILE* file);
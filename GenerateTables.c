@@ -0,0 +1,99 @@
+#include <stdio.h>
+#include <stdint.h>
+
+/*
+ * Generates BoardTables.h, the movement tables of the board, at build time.
+ * For every square, given by the bit position it has in the board masks (see Board.h),
+ * and for every diagonal direction, the tables hold the neighbouring square and the ray
+ * of all the squares up to the edge of the board, both as a mask and as a list ordered
+ * from the nearest square. The ghost bits have empty entries.
+ *
+ * Usage: GenerateTables > BoardTables.h
+ */
+
+#define SIZE       10
+#define NUM_OF_BITS 55
+#define MAX_RAY    (SIZE-1)
+
+/* the steps of the diagonal directions, in the order of the direction indices of Board.c */
+static const int DX[4] = {1, -1, 1, -1};
+static const int DY[4] = {1, 1, -1, -1};
+
+/*
+ * @return: the bit position of a square, or -1 if the position is not a playable square
+ */
+static int bitOf(int x, int y){
+	if (x < 1 || x > SIZE || y < 1 || y > SIZE || (x+y)%2){
+		return -1;
+	}
+	return ((x-1) + 11*(y-1))/2;
+}
+
+/*
+ * @return: the mask of a square, or 0 if the position is not a playable square
+ */
+static uint64_t maskOf(int x, int y){
+	int bit = bitOf(x, y);
+	return (bit < 0)? 0 : 1ULL << bit;
+}
+
+/*
+ * Finds the coordinates of a bit position.
+ *
+ * @return: 1 if the bit is a playable square, 0 if it is a ghost bit
+ */
+static int positionOf(int bit, int* x, int* y){
+	*x = (2*bit) % 11 + 1;
+	*y = (2*bit) / 11 + 1;
+	return *x <= SIZE;
+}
+
+/*
+ * Prints a table of masks, one row of four directions per square.
+ */
+static void printMasks(const char* name, int distance, int wholeRay){
+	printf("static const uint64_t %s[BoardTables_NUM_OF_BITS][4] = {\n", name);
+	for (int bit = 0; bit < NUM_OF_BITS; bit++){
+		int x, y;
+		int isSquare = positionOf(bit, &x, &y);
+		printf("\t{");
+		for (int direction = 0; direction < 4; direction++){
+			uint64_t mask = 0;
+			for (int step = distance; isSquare && step <= (wholeRay? MAX_RAY : distance); step++){
+				mask |= maskOf(x + step*DX[direction], y + step*DY[direction]);
+			}
+			printf("0x%016llXULL%s", (unsigned long long)mask, (direction < 3)? ", " : "");
+		}
+		printf("},\n");
+	}
+	printf("};\n\n");
+}
+
+int main(){
+	printf("/* Generated by GenerateTables.c, do not edit. */\n\n");
+	printf("#define BoardTables_NUM_OF_BITS %d\n", NUM_OF_BITS);
+	printf("#define BoardTables_MAX_RAY     %d\n\n", MAX_RAY);
+	printf("/* the neighbouring square in each direction */\n");
+	printMasks("neighbourMasks", 1, 0);
+	printf("/* all the squares in each direction, up to the edge of the board */\n");
+	printMasks("rayMasks", 1, 1);
+
+	printf("/* the bit positions of the squares in each direction, nearest first, terminated by -1 */\n");
+	printf("static const signed char rays[BoardTables_NUM_OF_BITS][4][BoardTables_MAX_RAY+1] = {\n");
+	for (int bit = 0; bit < NUM_OF_BITS; bit++){
+		int x, y;
+		int isSquare = positionOf(bit, &x, &y);
+		printf("\t{");
+		for (int direction = 0; direction < 4; direction++){
+			printf("{");
+			int step = 1;
+			for (; isSquare && bitOf(x + step*DX[direction], y + step*DY[direction]) >= 0; step++){
+				printf("%d, ", bitOf(x + step*DX[direction], y + step*DY[direction]));
+			}
+			printf("-1}%s", (direction < 3)? ", " : "");
+		}
+		printf("},\n");
+	}
+	printf("};\n");
+	return 0;
+}
@@ -0,0 +1,219 @@
+#include "Move.h"
+#include <stdio.h>
+
+#define SQUARE_BITS    6
+#define SQUARE_MASK    0x3FULL
+#define TO_SHIFT       6
+#define LANDINGS_SHIFT 12
+#define LANDINGS_MASK  0xFULL
+#define PATH_SHIFT     16
+
+/*
+ * @return: the index of the least significant set bit of a non-empty mask
+ */
+static int bitScan(uint64_t bits){
+#ifdef __GNUC__
+	return __builtin_ctzll(bits);
+#else
+	int index = 0;
+	while (!(bits & 1)){
+		bits >>= 1;
+		index++;
+	}
+	return index;
+#endif
+}
+
+/*
+ * @return: the index of the most significant set bit of a non-empty mask
+ */
+static int bitScanReverse(uint64_t bits){
+#ifdef __GNUC__
+	return 63 - __builtin_clzll(bits);
+#else
+	int index = 0;
+	while (bits >>= 1){
+		index++;
+	}
+	return index;
+#endif
+}
+
+/*
+ * @return: the number of set bits in the mask
+ */
+static int bitCount(uint64_t bits){
+#ifdef __GNUC__
+	return __builtin_popcountll(bits);
+#else
+	int count = 0;
+	while (bits){
+		bits &= bits - 1;
+		count++;
+	}
+	return count;
+#endif
+}
+
+/*
+ * Initializes a move of a single step, that captures nothing.
+ *
+ * @params: (from, to) - the start and destination squares
+ */
+void Move_init(struct Move* move, int from, int to){
+	move->captured = 0;
+	move->path = (uint64_t)from | ((uint64_t)to << TO_SHIFT);
+}
+
+/*
+ * Extends a move with another jump. Its current destination becomes a square landed on along the way.
+ *
+ * @params: (to) - the square the jump lands on
+ *          (captured) - the mask of the square of the piece the jump captures
+ */
+void Move_addJump(struct Move* move, int to, uint64_t captured){
+	int numOfLandings = Move_getNumOfLandings(move);
+	if (numOfLandings < Move_MAX_LANDINGS){
+		move->path |= (uint64_t)Move_getTo(move) << (PATH_SHIFT + SQUARE_BITS*numOfLandings);
+		move->path += 1ULL << LANDINGS_SHIFT;
+	}
+	move->path = (move->path & ~(SQUARE_MASK << TO_SHIFT)) | ((uint64_t)to << TO_SHIFT);
+	move->captured |= captured;
+}
+
+/*
+ * @return: the start square of the move
+ */
+int Move_getFrom(struct Move* move){
+	return move->path & SQUARE_MASK;
+}
+
+/*
+ * @return: the destination square of the move
+ */
+int Move_getTo(struct Move* move){
+	return (move->path >> TO_SHIFT) & SQUARE_MASK;
+}
+
+/*
+ * @return: the number of squares kept in the path between the start and the destination
+ */
+int Move_getNumOfLandings(struct Move* move){
+	return (move->path >> LANDINGS_SHIFT) & LANDINGS_MASK;
+}
+
+/*
+ * @params: (i) - the index of the landing, less than Move_getNumOfLandings
+ * @return: the (i)th square landed on between the start and the destination
+ */
+int Move_getLanding(struct Move* move, int i){
+	return (move->path >> (PATH_SHIFT + SQUARE_BITS*i)) & SQUARE_MASK;
+}
+
+/*
+ * @return: the number of pieces the move captures, 0 if it is not a jump move
+ */
+int Move_numOfCaptures(struct Move* move){
+	return bitCount(move->captured);
+}
+
+/*
+ * Checks whether two moves are the same move.
+ *
+ * @params: (other) - the move to be checked
+ * @return: 1 (true) if both moves are the same, 0 (false) otherwise
+ */
+int Move_equals(struct Move* this, struct Move* other){
+	return this->captured == other->captured && this->path == other->path;
+}
+
+/*
+ * Checks whether two moves pass through the same squares, regardless of what they capture.
+ * This is all that is known of a move read from the user.
+ *
+ * @params: (other) - the move to be checked
+ * @return: 1 (true) if both moves have the same path, 0 (false) otherwise
+ */
+int Move_hasSamePath(struct Move* this, struct Move* other){
+	return this->path == other->path;
+}
+
+/*
+ * @params: (x, y) - the coordinates of a playable square
+ * @return: the bit position of the square in the board masks
+ */
+int Move_square(int x, int y){
+	return ((x-1) + 11*(y-1))/2;
+}
+
+/*
+ * @params: (square) - the bit position of a square in the board masks
+ *          (x, y) - pointers to which the coordinates of the square will be written
+ */
+void Move_position(int square, int* x, int* y){
+	*x = (2*square) % 11 + 1;
+	*y = (2*square) / 11 + 1;
+}
+
+/*
+ * @params: (square) - the bit position of a square in the board masks
+ * @return: the number of the square in the standard notation: 1 to 50, row by row
+ *          from the top left corner, with white's side at the bottom
+ */
+int Move_number(int square){
+	int x, y;
+	Move_position(square, &x, &y);
+	return (10-y)*5 + (x-1)/2 + 1;
+}
+
+/*
+ * @params: (number) - the number of a square in the standard notation
+ * @return: the bit position of the square in the board masks, or -1 if there is no such square
+ */
+int Move_squareOfNumber(int number){
+	if (number < 1 || number > 50){
+		return -1;
+	}
+	int y = 10 - (number-1)/5;
+	int x = 2*((number-1)%5) + 1 + (y%2 == 0);
+	return Move_square(x, y);
+}
+
+/*
+ * Writes the move in the standard notation: the numbers of the squares it passes through,
+ * joined by "-" for a single step, or by "x" for a jump move, e.g. "32-28" or "28x19x10".
+ *
+ * @params: (str) - a buffer of at least Move_STRING_LENGTH characters
+ * @return: the length of the string written
+ */
+int Move_toString(struct Move* move, char* str){
+	char separator = move->captured? 'x' : '-';
+	int length = sprintf(str, "%d", Move_number(Move_getFrom(move)));
+	for (int i = 0; i < Move_getNumOfLandings(move); i++){
+		length += sprintf(str+length, "%c%d", separator, Move_number(Move_getLanding(move, i)));
+	}
+	length += sprintf(str+length, "%c%d", separator, Move_number(Move_getTo(move)));
+	return length;
+}
+
+/*
+ * Prints a square in the format: "<x,y>".
+ */
+static void printSquare(int square){
+	int x, y;
+	Move_position(square, &x, &y);
+	printf("<%c,%d>", x+96, y);
+}
+
+/* 
+ * Prints the move in the format: "move <x,y> to <i,j>[<k,l>...]".
+ */
+void Move_print(struct Move* move){
+	printf("move ");
+	printSquare(Move_getFrom(move));
+	printf(" to ");
+	for (int i = 0; i < Move_getNumOfLandings(move); i++){
+		printSquare(Move_getLanding(move, i));
+	}
+	printSquare(Move_getTo(move));
+}
@@ -0,0 +1,47 @@
+#include <stdint.h>
+
+#define Move_MAX_LANDINGS 8
+#define Move_STRING_LENGTH (3*(Move_MAX_LANDINGS+2) + 1) /* "nn" and a separator for every square */
+
+/*
+ * A move packed into two 64-bit words. Squares are the bit positions of the board masks (see Board.h).
+ * The path holds the start square in bits 0-5, the destination square in bits 6-11, the number of
+ * squares landed on between them in bits 12-15, and those squares, 6 bits each, from bit 16 on.
+ * Only the first Move_MAX_LANDINGS of them are kept, which is enough for any capture of up to
+ * Move_MAX_LANDINGS+1 pieces; the captured mask is always complete.
+ * Moves are plain values: they are copied with assignment and compared as integers.
+ */
+struct Move{
+	uint64_t captured;  /* the mask of the squares of the captured pieces */
+	uint64_t path;
+};
+
+void Move_init          (struct Move* move, int from, int to);
+
+void Move_addJump       (struct Move* move, int to, uint64_t captured);
+
+int  Move_getFrom       (struct Move* move);
+
+int  Move_getTo         (struct Move* move);
+
+int  Move_getNumOfLandings(struct Move* move);
+
+int  Move_getLanding    (struct Move* move, int i);
+
+int  Move_numOfCaptures (struct Move* move);
+
+int  Move_equals        (struct Move* this, struct Move* other);
+
+int  Move_hasSamePath   (struct Move* this, struct Move* other);
+
+int  Move_square        (int x, int y);
+
+void Move_position      (int square, int* x, int* y);
+
+int  Move_number        (int square);
+
+int  Move_squareOfNumber(int number);
+
+int  Move_toString      (struct Move* move, char* str);
+
+void Move_print         (struct Move* move);
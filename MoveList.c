@@ -0,0 +1,90 @@
+#include "MoveList.h"
+#include <stdlib.h>
+
+/*
+ * Empties the list.
+ */
+void MoveList_clear(struct MoveList* list){
+	list->length = 0;
+}
+
+/*
+ * Adds a move at the end of the list. Moves beyond the capacity of the list are dropped.
+ *
+ * @params: (move) - the move to be copied into the list
+ */
+void MoveList_add(struct MoveList* list, struct Move* move){
+	if (list->length < MoveList_CAPACITY){
+		list->moves[list->length++] = *move;
+	}
+}
+
+/*
+ * Finds the move in the list that has the same path as a given move.
+ *
+ * @params: (move) - the move to be found
+ * @return: NULL if no such move is in the list, a pointer to the move in the list otherwise
+ */
+struct Move* MoveList_find(struct MoveList* list, struct Move* move){
+	for (int i = 0; i < list->length; i++){
+		if (Move_hasSamePath(&list->moves[i], move)){
+			return &list->moves[i];
+		}
+	}
+	return NULL;
+}
+
+/*
+ * Finds the move in the list that a string in the standard notation stands for (see Move_toString).
+ * A jump move may also be given by its start and destination alone, e.g. "28x10",
+ * in which case the first move in the list that matches them is found.
+ *
+ * @params: (str) - the move in the standard notation, ending with the string
+ * @return: NULL if the string isn't a move in the list, a pointer to the move in the list otherwise
+ */
+struct Move* MoveList_parse(struct MoveList* list, const char* str){
+	int squares[Move_MAX_LANDINGS+2];
+	int numOfSquares = 0;
+	while (1){
+		char* end;
+		long number = strtol(str, &end, 10);
+		if (end == str || numOfSquares == Move_MAX_LANDINGS+2){
+			return NULL;
+		}
+		squares[numOfSquares] = Move_squareOfNumber(number);
+		if (squares[numOfSquares++] < 0){
+			return NULL;
+		}
+		if (*end == '\0'){
+			break;
+		}
+		if (*end != '-' && *end != 'x'){
+			return NULL;
+		}
+		str = end+1;
+	}
+	for (int i = 0; i < list->length; i++){
+		struct Move* move = &list->moves[i];
+		if (numOfSquares < 2 || Move_getFrom(move) != squares[0] || Move_getTo(move) != squares[numOfSquares-1]){
+			continue;
+		}
+		int matches = numOfSquares == 2 || Move_getNumOfLandings(move) == numOfSquares-2;
+		for (int j = 0; matches && numOfSquares > 2 && j < numOfSquares-2; j++){
+			matches = Move_getLanding(move, j) == squares[j+1];
+		}
+		if (matches){
+			return move;
+		}
+	}
+	return NULL;
+}
+
+/*
+ * Prints the list, a move per line.
+ */
+void MoveList_print(struct MoveList* list){
+	for (int i = 0; i < list->length; i++){
+		Move_print(&list->moves[i]);
+		printf("\n");
+	}
+}
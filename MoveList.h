@@ -0,0 +1,22 @@
+#include "Move.c"
+
+#define MoveList_CAPACITY 256
+
+/*
+ * A list of moves of fixed capacity, stored contiguously so it can live on the stack.
+ * The capacity is well above the number of legal moves in any position that arises in a game.
+ */
+struct MoveList{
+	int length;
+	struct Move moves[MoveList_CAPACITY];
+};
+
+void MoveList_clear(struct MoveList* list);
+
+void MoveList_add  (struct MoveList* list, struct Move* move);
+
+struct Move* MoveList_find(struct MoveList* list, struct Move* move);
+
+struct Move* MoveList_parse(struct MoveList* list, const char* str);
+
+void MoveList_print(struct MoveList* list);
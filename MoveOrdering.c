@@ -0,0 +1,114 @@
+#include "MoveOrdering.h"
+
+#define HASH_MOVE_SCORE  (1 << 30)
+#define CAPTURE_SCORE    (1 << 24)
+#define KILLER_SCORE     (1 << 20)
+#define MAX_HISTORY      (1 << 19)
+#define NO_KILLER        -1
+
+/*
+ * @return: an identifier of a move, made of its start and destination squares
+ */
+static int moveIdentifier(struct Move* move){
+	return Move_getFrom(move) * MoveOrdering_SQUARES + Move_getTo(move);
+}
+
+/*
+ * Forgets all the collected heuristics.
+ */
+void MoveOrdering_clear(struct MoveOrdering* ordering){
+	memset(ordering->history, 0, sizeof(ordering->history));
+	MoveOrdering_newSearch(ordering);
+}
+
+/*
+ * Halves the history, so that recent cutoffs weigh more than old ones.
+ */
+static void ageHistory(struct MoveOrdering* ordering){
+	for (int from = 0; from < MoveOrdering_SQUARES; from++){
+		for (int to = 0; to < MoveOrdering_SQUARES; to++){
+			ordering->history[from][to] /= 2;
+		}
+	}
+}
+
+/*
+ * Prepares the heuristics for a search from a new position. The killers are forgotten,
+ * since the plies no longer match, and the history is aged.
+ */
+void MoveOrdering_newSearch(struct MoveOrdering* ordering){
+	for (int ply = 0; ply < MoveOrdering_MAX_PLY; ply++){
+		for (int i = 0; i < MoveOrdering_KILLERS; i++){
+			ordering->killers[ply][i] = NO_KILLER;
+		}
+	}
+	ageHistory(ordering);
+}
+
+/*
+ * Sorts a list of moves into the order in which they should be searched:
+ * the hash move first, then the moves that capture the most pieces, then the killer moves,
+ * and then the rest of the quiet moves by their history.
+ *
+ * @params: (moves) - the list of possible moves of the player to move
+ *          (hashMove) - the index of the best move stored in the transposition table,
+ *                       or TranspositionTable_NO_MOVE
+ *          (ply) - the distance of the position from the root of the search
+ *          (ordered) - an array, as long as the list, to which the sorted moves will be written
+ */
+void MoveOrdering_order(struct MoveOrdering* ordering, struct MoveList* moves, int hashMove, int ply,
+		struct ScoredMove* ordered){
+	int* killers = ordering->killers[ply < MoveOrdering_MAX_PLY? ply : MoveOrdering_MAX_PLY-1];
+	for (int length = 0; length < moves->length; length++){
+		struct Move* move = &moves->moves[length];
+		struct ScoredMove scored;
+		scored.move = move;
+		scored.index = length;
+		int captures = Move_numOfCaptures(move);
+		scored.isCapture = (captures > 0);
+		if (length == hashMove){
+			scored.score = HASH_MOVE_SCORE;
+		}
+		else if (scored.isCapture){
+			scored.score = CAPTURE_SCORE + captures;
+		}
+		else{
+			int identifier = moveIdentifier(move);
+			scored.score = ordering->history[identifier / MoveOrdering_SQUARES][identifier % MoveOrdering_SQUARES];
+			for (int i = 0; i < MoveOrdering_KILLERS; i++){
+				if (killers[i] == identifier){
+					scored.score = KILLER_SCORE - i;
+				}
+			}
+		}
+		//insertion sort, keeping moves of equal score in the order they were generated
+		int position = length;
+		while (position > 0 && ordered[position-1].score < scored.score){
+			ordered[position] = ordered[position-1];
+			position--;
+		}
+		ordered[position] = scored;
+	}
+}
+
+/*
+ * Records a quiet move that caused a cutoff, as a killer of its ply and in the history.
+ *
+ * @params: (move) - the move that caused the cutoff
+ *          (ply) - the distance of the position from the root of the search
+ *          (depth) - the remaining depth of the search at the position
+ */
+void MoveOrdering_update(struct MoveOrdering* ordering, struct Move* move, int ply, int depth){
+	int identifier = moveIdentifier(move);
+	if (ply < MoveOrdering_MAX_PLY && ordering->killers[ply][0] != identifier){
+		for (int i = MoveOrdering_KILLERS-1; i > 0; i--){
+			ordering->killers[ply][i] = ordering->killers[ply][i-1];
+		}
+		ordering->killers[ply][0] = identifier;
+	}
+	int* history = &ordering->history[identifier / MoveOrdering_SQUARES][identifier % MoveOrdering_SQUARES];
+	*history += depth * depth;
+	if (*history > MAX_HISTORY){
+		ageHistory(ordering);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,34 @@
+#include "TranspositionTable.c"
+
+#define MoveOrdering_MAX_PLY  128
+#define MoveOrdering_KILLERS  2
+#define MoveOrdering_SQUARES  64  /* the bit positions of the squares in the board masks */
+
+/*
+ * A move together with the score that determines when it will be searched.
+ */
+struct ScoredMove{
+	struct Move* move;
+	int index;     /* the index of the move in the list written by Board_generateMoves */
+	int score;
+	int isCapture;
+};
+
+/*
+ * The move ordering heuristics collected during a search. Quiet moves are identified
+ * by their start and destination squares: the killers are the last quiet moves that
+ * caused a cutoff at each ply, and the history counts the cutoffs of each (from, to) pair.
+ */
+struct MoveOrdering{
+	int killers[MoveOrdering_MAX_PLY][MoveOrdering_KILLERS];
+	int history[MoveOrdering_SQUARES][MoveOrdering_SQUARES];
+};
+
+void MoveOrdering_clear    (struct MoveOrdering* ordering);
+
+void MoveOrdering_newSearch(struct MoveOrdering* ordering);
+
+void MoveOrdering_order    (struct MoveOrdering* ordering, struct MoveList* moves, int hashMove, int ply,
+		struct ScoredMove* ordered);
+
+void MoveOrdering_update   (struct MoveOrdering* ordering, struct Move* move, int ply, int depth);
\ No newline at end of file
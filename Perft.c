@@ -0,0 +1,57 @@
+#include "Perft.h"
+
+/*
+ * Counts the positions reachable from a board in an exact number of moves (perft).
+ * The board is restored to its original state on return.
+ *
+ * @params: (player) - the player to move
+ *          (depth) - the number of moves
+ * @return: the number of positions
+ */
+long Perft_count(struct Board* board, int player, int depth){
+	if (depth == 0){
+		return 1;
+	}
+	if (depth == 1){
+		return Board_countMoves(board, player);
+	}
+	struct MoveList possibleMoves;
+	Board_generateMoves(board, player, &possibleMoves);
+	long count = 0;
+	struct MoveUndo undo;
+	for (int i = 0; i < possibleMoves.length; i++){
+		struct Move* move = &possibleMoves.moves[i];
+		Board_makeMove(board, move, &undo);
+		count += Perft_count(board, !player, depth-1);
+		Board_unmakeMove(board, move, &undo);
+	}
+	return count;
+}
+
+/*
+ * Runs perft from a board and prints the number of positions under each possible move,
+ * followed by the total, the time it took and the number of positions per second.
+ *
+ * @params: (player) - the player to move
+ *          (depth) - the number of moves, at least 1
+ */
+void Perft_divide(struct Board* board, int player, int depth){
+	long startTime = Search_currentTimeMillis();
+	struct MoveList possibleMoves;
+	Board_generateMoves(board, player, &possibleMoves);
+	long total = 0;
+	struct MoveUndo undo;
+	for (int i = 0; i < possibleMoves.length; i++){
+		struct Move* move = &possibleMoves.moves[i];
+		Board_makeMove(board, move, &undo);
+		long subtree = Perft_count(board, !player, depth-1);
+		Board_unmakeMove(board, move, &undo);
+		Move_print(move);
+		printf(": %ld\n", subtree);
+		total += subtree;
+	}
+	long elapsed = Search_currentTimeMillis() - startTime;
+	printf("Nodes: %ld\n", total);
+	printf("Time: %ld ms\n", elapsed);
+	printf("Nodes per second: %.0f\n", total * 1000.0 / (elapsed > 0? elapsed : 1));
+}
\ No newline at end of file
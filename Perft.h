@@ -0,0 +1,5 @@
+#include "Search.c"
+
+long Perft_count (struct Board* board, int player, int depth);
+
+void Perft_divide(struct Board* board, int player, int depth);
\ No newline at end of file
@@ -0,0 +1,25 @@
+#define _POSIX_C_SOURCE 199309L /* for clock_gettime */
+#include "Perft.c"
+
+/*
+ * A standalone perft runner, for measuring the move generator and checking it against
+ * known position counts. Runs from the standard initial position, white to move.
+ *
+ * Usage: perft <depth>
+ */
+int main(int argc, char* argv[]){
+	if (argc != 2 || strtol(argv[1], NULL, 10) < 1){
+		fprintf(stderr, "Usage: %s <depth>\n", argv[0]);
+		return 1;
+	}
+	int depth = strtol(argv[1], NULL, 10);
+	struct Board* board = Board_new();
+	if (board == NULL){
+		fprintf(stderr, "Error: standard function calloc has failed\n");
+		return 1;
+	}
+	Board_init(board);
+	Perft_divide(board, WHITE, depth);
+	Board_free(board);
+	return 0;
+}
\ No newline at end of file
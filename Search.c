@@ -0,0 +1,609 @@
+#include "Search.h"
+
+#define NODES_BETWEEN_CLOCK_CHECKS 1024
+#define ASPIRATION_WINDOW          1 /* the value of a man */
+
+/*
+ * @return: the current wall-clock time in milliseconds, from an arbitrary starting point
+ */
+long Search_currentTimeMillis(){
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec * 1000L + now.tv_nsec / 1000000L;
+}
+
+/*
+ * Draws a pseudo-random number from a generator (xorshift64). The games use it as well.
+ *
+ * @params: (state) - the state of the generator, which must not be 0
+ * @return: the next pseudo-random number
+ */
+static uint64_t xorshift(uint64_t* state){
+	uint64_t x = *state;
+	x ^= x << 13;
+	x ^= x >> 7;
+	x ^= x << 17;
+	*state = x;
+	return x;
+}
+
+/*
+ * Checks whether the search should stop, right after a node was counted. The main thread also
+ * checks every once in a while whether the time for the search is up, and if so, tells all the threads to stop.
+ *
+ * @return: 1 (true) if the search should stop, 0 (false) otherwise
+ */
+static int checkSearchAborted(struct SearchThread* thread){
+	struct Search* search = thread->search;
+	long nodes = thread->nodes + thread->quiescenceNodes;
+	if (thread->id == 0 && search->deadline != 0 && nodes % NODES_BETWEEN_CLOCK_CHECKS == 0
+			&& Search_currentTimeMillis() >= search->deadline){
+		search->stop = 1;
+	}
+	return search->stop;
+}
+
+/*
+ * Checks whether a root move belongs to one of the lines excluded from a multi-PV search.
+ *
+ * @return: 1 (true) if the move must be skipped, 0 (false) otherwise
+ */
+static int isExcluded(struct Search* search, struct Move* move){
+	for (int i = 0; i < search->numOfExcluded; i++){
+		if (Move_equals(move, &search->excluded[i].moves[0])){
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/*
+ * Scores a board on which the search stops. Boards found in the tablebases get their exact
+ * score, unless the game is already over on them.
+ *
+ * @params: (player) - the player to move, whose point of view the score is from
+ * @return: the score of the board
+ */
+static int scoreLeaf(struct Board* board, int player){
+	int score = Board_getScore(board, player);
+	if (score > -100 && score < 100){
+		Tablebase_probe(board, player, &score);
+	}
+	return score;
+}
+
+/*
+ * Resolves the captures pending at a leaf of the main search before the board is scored,
+ * so that a leaf in the middle of an exchange isn't scored as if the exchange was over.
+ * Captures are compulsory, so as long as the player to move can capture, all of the captures
+ * are searched and there is no standing pat; once no capture is possible, the board is scored.
+ * Every capture removes pieces from the board, so the search always ends.
+ *
+ * @params: (alpha, beta) - the window of scores that are of interest to the caller
+ *          (player) - the player to move
+ * @return: the score of the board, fail-soft as in minimax
+ */
+static int quiescence(struct SearchThread* thread, int alpha, int beta, int player){
+	struct Board* board = &thread->board;
+	thread->quiescenceNodes++;
+	if (checkSearchAborted(thread)){
+		return 0;
+	}
+	if (!Board_hasPossibleJump(board, player)){
+		return scoreLeaf(board, player);
+	}
+	struct MoveList captures;
+	Board_generateMoves(board, player, &captures);
+	struct MoveUndo undo;
+	int best = -Search_INFINITE_SCORE;
+	for (int i = 0; i < captures.length; i++){
+		struct Move* capture = &captures.moves[i];
+		Board_makeMove(board, capture, &undo);
+		int score = -quiescence(thread, -beta, -alpha, !player);
+		Board_unmakeMove(board, capture, &undo);
+		if (thread->search->stop){
+			return 0;
+		}
+		if (score > best){
+			best = score;
+		}
+		if (best > alpha){
+			alpha = best;
+		}
+		if (alpha >= beta){
+			break;
+		}
+	}
+	return best;
+}
+
+/*
+ * The minimax AI algorithm, in its negamax form with alpha-beta pruning.
+ * All the moves are carried out and taken back on the thread's board, and scores are
+ * always from the point of view of the player to move. The result is fail-soft:
+ * a score <= alpha is an upper bound, and a score >= beta is a lower bound.
+ * Moves are searched in the order given by the move ordering heuristics, as a principal
+ * variation search: the first move is searched with the full window, and the others only with
+ * a null window, which is enough to prove they are no better; a move that turns out better is
+ * searched again with the full window to get its exact score. Late quiet moves are first
+ * searched to a reduced depth (see struct Reductions), unless the position is a capture, or
+ * the move promotes or lets the opponent capture, and the full depth search is only done
+ * if the reduced search finds them better than expected. Results
+ * are stored in the transposition table, so positions that were already searched
+ * deep enough (by any thread) are not searched again. During a multi-PV search, the root moves
+ * of the lines already found are skipped at the root of the main thread. If the search is stopped,
+ * it unwinds immediately and its result must be ignored. The leaves are handed over to
+ * the quiescence search, and boards found in the tablebases are not searched at all.
+ *
+ * @params: (depth) - the remaining depth of the search
+ *          (ply) - the distance of the board from the root of the search
+ *          (alpha, beta) - the window of scores that are of interest to the caller
+ *          (player) - the player to move
+ *          (bestMove) - a pointer to which the best move will be written, or NULL if it isn't needed.
+ *                       Nothing is written if the player has no possible move.
+ * @return: the score of the board
+ */
+static int minimax(struct SearchThread* thread, int depth, int ply, int alpha, int beta, int player, struct Move* bestMove){
+	struct Search* search = thread->search;
+	struct Board* board = &thread->board;
+	if (depth == 0){
+		return quiescence(thread, alpha, beta, player);
+	}
+	thread->nodes++;
+	if (checkSearchAborted(thread)){
+		return 0;
+	}
+	int tablebaseScore;
+	if (bestMove == NULL && Tablebase_probe(board, player, &tablebaseScore)){
+		return tablebaseScore;
+	}
+	uint64_t key = Board_getKey(board, player);
+	struct TableEntry entry;
+	int hashMove = TranspositionTable_NO_MOVE;
+	if (TranspositionTable_probe(search->table, key, &entry)){
+		hashMove = entry.bestMove;
+		if (bestMove == NULL && entry.depth >= depth && (entry.bound == TranspositionTable_EXACT ||
+				(entry.bound == TranspositionTable_LOWER_BOUND && entry.score >= beta) ||
+				(entry.bound == TranspositionTable_UPPER_BOUND && entry.score <= alpha))){
+			return entry.score;
+		}
+	}
+	struct MoveList possibleMoves;
+	Board_generateMoves(board, player, &possibleMoves);
+	int numOfMoves = possibleMoves.length;
+	if (numOfMoves == 0){
+		return Board_getScore(board, player);
+	}
+	if (bestMove != NULL && numOfMoves == 1 && search->excluded == NULL){ // a forced move needs no search
+		*bestMove = possibleMoves.moves[0];
+		return scoreLeaf(board, player);
+	}
+	struct ScoredMove orderedMoves[numOfMoves];
+	MoveOrdering_order(&thread->ordering, &possibleMoves, hashMove, ply, orderedMoves);
+	
+	struct Reductions* reductions = &search->reductions;
+	int mayReduce = bestMove == NULL && reductions->plies > 0 && depth >= reductions->minDepth
+			&& possibleMoves.moves[0].captured == 0;
+	int breakTies = bestMove != NULL && search->excluded == NULL;
+	struct MoveUndo undo;
+	struct Move* bestPossibleMove = NULL;
+	int bestIndex = TranspositionTable_NO_MOVE;
+	int originalAlpha = alpha;
+	int best = -Search_INFINITE_SCORE;
+	for (int i = 0; i < numOfMoves; i++){
+		struct Move* currentMove = orderedMoves[i].move;
+		if (bestMove != NULL && isExcluded(search, currentMove)){
+			continue;
+		}
+		/* at the root, moves equal to the best so far are searched exactly, so that ties can be broken randomly */
+		int lowerBound = (breakTies && alpha == best)? alpha-1 : alpha;
+		Board_makeMove(board, currentMove, &undo);
+		int score;
+		if (bestPossibleMove == NULL){
+			score = -minimax(thread, depth-1, ply+1, -beta, -lowerBound, !player, NULL);
+		}
+		else{
+			score = lowerBound+1; /* until proven otherwise, the move must be searched to the full depth */
+			if (mayReduce && i >= reductions->minMoves && !undo.promoted && !Board_hasPossibleJump(board, !player)){
+				int reducedDepth = (depth-1 > reductions->plies)? depth-1-reductions->plies : 0;
+				score = -minimax(thread, reducedDepth, ply+1, -lowerBound-1, -lowerBound, !player, NULL);
+			}
+			if (score > lowerBound && !search->stop){
+				score = -minimax(thread, depth-1, ply+1, -lowerBound-1, -lowerBound, !player, NULL);
+			}
+			if (lowerBound < alpha && score > lowerBound && !search->stop){
+				/* at least a tie; a second scout tells whether it is any better */
+				score = -minimax(thread, depth-1, ply+1, -alpha-1, -alpha, !player, NULL);
+				if (score <= alpha){
+					score = alpha;
+				}
+			}
+			if (score > alpha && score < beta && !search->stop){
+				score = -minimax(thread, depth-1, ply+1, -beta, -alpha, !player, NULL);
+			}
+		}
+		Board_unmakeMove(board, currentMove, &undo);
+		if (search->stop){
+			return 0;
+		}
+		if (score > best || (score == best && breakTies && xorshift(&thread->randomState)%2)){
+			best = score;
+			bestPossibleMove = currentMove;
+			bestIndex = orderedMoves[i].index;
+		}
+		if (best > alpha){
+			alpha = best;
+		}
+		if (alpha >= beta){
+			if (!orderedMoves[i].isCapture){
+				MoveOrdering_update(&thread->ordering, currentMove, ply, depth);
+			}
+			break;
+		}
+	}
+	if (bestMove != NULL){
+		*bestMove = *bestPossibleMove;
+	}
+	int bound = TranspositionTable_EXACT;
+	if (best <= originalAlpha){
+		bound = TranspositionTable_UPPER_BOUND;
+	}
+	if (best >= beta){
+		bound = TranspositionTable_LOWER_BOUND;
+	}
+	if (bestMove != NULL && search->numOfExcluded > 0){ // not the score of the whole board
+		return best;
+	}
+	TranspositionTable_store(search->table, key, depth, bound, best, bestIndex);
+	return best;
+}
+
+/*
+ * The procedure of the helper threads: iterative deepening from a staggered depth,
+ * until the main thread stops the search.
+ */
+static void* helperThread(void* data){
+	struct SearchThread* thread = (struct SearchThread*)data;
+	struct Search* search = thread->search;
+	for (int depth = 1 + thread->id % 2; depth <= search->maxDepth && !search->stop; depth++){
+		minimax(thread, depth, 0, -Search_INFINITE_SCORE, Search_INFINITE_SCORE, search->player, NULL);
+	}
+	return NULL;
+}
+
+/*
+ * Creates a new search.
+ *
+ * @params: (table) - the transposition table the threads will share
+ *          (numOfThreads) - the number of threads that will search, including the main thread
+ * @return: NULL if any allocation errors occurred, the search otherwise
+ */
+struct Search* Search_new(struct TranspositionTable* table, int numOfThreads){
+	struct Search* search;
+	search = (struct Search*)calloc(1, sizeof(struct Search));
+	if (!search){
+		return NULL;
+	}
+	search->threads = (struct SearchThread*)calloc(numOfThreads, sizeof(struct SearchThread));
+	if (!search->threads){
+		free(search);
+		return NULL;
+	}
+	search->table = table;
+	search->numOfThreads = numOfThreads;
+	search->reductions.minDepth = Search_DEFAULT_REDUCTION_DEPTH;
+	search->reductions.minMoves = Search_DEFAULT_REDUCTION_MOVES;
+	search->reductions.plies = Search_DEFAULT_REDUCTION;
+	for (int i = 0; i < numOfThreads; i++){
+		struct SearchThread* thread = &search->threads[i];
+		thread->search = search;
+		thread->id = i;
+		MoveOrdering_clear(&thread->ordering);
+	}
+	Search_seed(search, 0);
+	return search;
+}
+
+/*
+ * Searches the root to a given depth with an aspiration window: a narrow window around the
+ * score of the previous iteration, which is widened on the failing side, and searched again,
+ * until the score falls inside it.
+ *
+ * @params: (depth) - the depth of the search
+ *          (previousScore) - the score of the previous iteration
+ *          (bestMove) - a pointer to which the best move will be written
+ * @return: the score of the board, to be ignored if the search was stopped
+ */
+static int aspirationSearch(struct SearchThread* thread, int depth, int previousScore, int player, struct Move* bestMove){
+	int delta = ASPIRATION_WINDOW;
+	int alpha = -Search_INFINITE_SCORE;
+	int beta = Search_INFINITE_SCORE;
+	if (depth > 1){
+		alpha = previousScore - delta;
+		beta = previousScore + delta;
+	}
+	while (1){
+		int score = minimax(thread, depth, 0, alpha, beta, player, bestMove);
+		if (thread->search->stop){
+			return 0;
+		}
+		if (score <= alpha && alpha > -Search_INFINITE_SCORE){
+			alpha = (score - 2*delta > -Search_INFINITE_SCORE)? score - 2*delta : -Search_INFINITE_SCORE;
+		}
+		else if (score >= beta && beta < Search_INFINITE_SCORE){
+			beta = (score + 2*delta < Search_INFINITE_SCORE)? score + 2*delta : Search_INFINITE_SCORE;
+		}
+		else{
+			return score;
+		}
+		delta *= 2;
+	}
+}
+
+/*
+ * Prepares the threads for a new search of a board, and starts the helper threads.
+ *
+ * @return: the number of helper threads that were started
+ */
+static int startSearch(struct Search* search, struct Board* board, int player, int maxDepth){
+	search->player = player;
+	search->maxDepth = maxDepth;
+	search->deadline = 0; /* the first iteration always completes, so there is a move to return */
+	search->stop = search->isStopRequested; /* a search stopped before it started returns at once */
+	TranspositionTable_newSearch(search->table);
+	for (int i = 0; i < search->numOfThreads; i++){
+		struct SearchThread* thread = &search->threads[i];
+		Board_copy(&thread->board, board);
+		MoveOrdering_newSearch(&thread->ordering);
+		thread->nodes = 0;
+		thread->quiescenceNodes = 0;
+	}
+	int numOfHelpers = 0;
+	while (numOfHelpers+1 < search->numOfThreads){
+		struct SearchThread* helper = &search->threads[numOfHelpers+1];
+		if (pthread_create(&helper->handle, NULL, &helperThread, helper) != 0){
+			break; // search with the threads that did start
+		}
+		numOfHelpers++;
+	}
+	return numOfHelpers;
+}
+
+/*
+ * Stops the helper threads, and waits for them to finish.
+ */
+static void stopSearch(struct Search* search, int numOfHelpers){
+	search->stop = 1;
+	for (int i = 1; i <= numOfHelpers; i++){
+		pthread_join(search->threads[i].handle, NULL);
+	}
+}
+
+/*
+ * Checks, after an iteration of iterative deepening, whether the time for the search is up.
+ * The deadline is only set once the first iteration is done.
+ *
+ * @return: 1 (true) if no further iteration should start, 0 (false) otherwise
+ */
+static int isTimeUp(struct Search* search, long startTime, long timePerMove){
+	if (timePerMove > 0){
+		search->deadline = startTime + timePerMove;
+		return Search_currentTimeMillis() >= search->deadline;
+	}
+	return 0;
+}
+
+/*
+ * Completes a line whose root move is known with the best replies stored in the transposition
+ * table, as long as they are found, up to the depth of the search that found the line.
+ *
+ * @params: (board) - the root board of the line
+ *          (player) - the player to move at the root
+ *          (depth) - the depth of the search that found the line
+ *          (line) - the line, holding only its root move
+ */
+static void completeLine(struct Search* search, struct Board* board, int player, int depth, struct PrincipalVariation* line){
+	struct Board position;
+	struct TableEntry entry;
+	struct MoveList possibleMoves;
+	Board_copy(&position, board);
+	Board_update(&position, &line->moves[0]);
+	line->length = 1;
+	player = !player;
+	while (line->length < depth && line->length < Search_MAX_PV_LENGTH){
+		if (!TranspositionTable_probe(search->table, Board_getKey(&position, player), &entry)){
+			break;
+		}
+		Board_generateMoves(&position, player, &possibleMoves);
+		if (entry.bestMove >= possibleMoves.length){ // no move, or a torn entry
+			break;
+		}
+		line->moves[line->length++] = possibleMoves.moves[entry.bestMove];
+		Board_update(&position, &possibleMoves.moves[entry.bestMove]);
+		player = !player;
+	}
+}
+
+/*
+ * Searches for the best move of a player with iterative deepening: the board is searched
+ * to depth 1, 2, 3 and so on, until the time per move runs out or the maximal depth is reached.
+ * Every iteration starts with an aspiration window around the score of the one before it.
+ * If the time runs out during an iteration, the move found by the last completed iteration is used.
+ * The helper threads search alongside the main thread until it is done. If the search has a report
+ * function, it is called by the searching thread with the line found by every completed iteration.
+ *
+ * @params: (board) - the board to be searched
+ *          (player) - the player to move, who must have a possible move
+ *          (maxDepth) - the depth of the last iteration
+ *          (timePerMove) - the time limit of the search in milliseconds, or 0 for no limit
+ * @return: the best move
+ */
+struct Move Search_bestMove(struct Search* search, struct Board* board, int player, int maxDepth, long timePerMove){
+	long startTime = Search_currentTimeMillis();
+	struct SearchThread* mainThread = &search->threads[0];
+	struct MoveList possibleMoves;
+	Board_generateMoves(board, player, &possibleMoves);
+	struct Move bestMove = possibleMoves.moves[0]; /* in case the search is stopped before its first iteration is done */
+	int numOfHelpers = startSearch(search, board, player, maxDepth);
+	int score = 0;
+	for (int depth = 1; depth <= maxDepth; depth++){
+		struct Move iterationMove;
+		score = aspirationSearch(mainThread, depth, score, player, &iterationMove);
+		if (search->stop){
+			break;
+		}
+		bestMove = iterationMove;
+		if (search->report != NULL){
+			struct PrincipalVariation line;
+			line.score = score;
+			line.moves[0] = bestMove;
+			completeLine(search, board, player, depth, &line);
+			search->report(search, depth, score, &line);
+		}
+		if (score >= 100 || score <= -100){ // the game is decided, searching deeper won't change that
+			break;
+		}
+		if (possibleMoves.length == 1){ // the move is forced, and isn't searched at any depth
+			break;
+		}
+		if (isTimeUp(search, startTime, timePerMove)){
+			break;
+		}
+	}
+	stopSearch(search, numOfHelpers);
+	return bestMove;
+}
+
+/*
+ * Searches for the best lines of a player with iterative deepening, like Search_bestMove.
+ * In every iteration, the root is searched once for every line, each time skipping the root
+ * moves of the lines found before, so the lines come out ordered from best to worst. All of
+ * these searches share the transposition table, so each of them reuses the work of the others,
+ * and of the previous iteration.
+ *
+ * @params: (board) - the board to be searched
+ *          (player) - the player to move
+ *          (numOfLines) - the number of lines wanted
+ *          (maxDepth) - the depth of the last iteration
+ *          (timePerMove) - the time limit of the search in milliseconds, or 0 for no limit
+ *          (lines) - an array of at least numOfLines lines, to which the lines will be written
+ * @return: the number of lines written, which is less than numOfLines if the player has fewer possible moves
+ */
+int Search_multiPV(struct Search* search, struct Board* board, int player, int numOfLines, int maxDepth, long timePerMove,
+		struct PrincipalVariation* lines){
+	long startTime = Search_currentTimeMillis();
+	struct SearchThread* mainThread = &search->threads[0];
+	struct MoveList possibleMoves;
+	Board_generateMoves(board, player, &possibleMoves);
+	if (numOfLines > possibleMoves.length){
+		numOfLines = possibleMoves.length;
+	}
+	if (numOfLines == 0){
+		return 0;
+	}
+	struct PrincipalVariation iterationLines[numOfLines];
+	int numOfHelpers = startSearch(search, board, player, maxDepth);
+	search->excluded = iterationLines;
+	for (int depth = 1; depth <= maxDepth; depth++){
+		for (int i = 0; i < numOfLines; i++){
+			search->numOfExcluded = i;
+			int previousScore = (depth > 1)? lines[i].score : 0;
+			int score = aspirationSearch(mainThread, depth, previousScore, player, &iterationLines[i].moves[0]);
+			if (search->stop){
+				break;
+			}
+			iterationLines[i].score = score;
+			completeLine(search, board, player, depth, &iterationLines[i]);
+		}
+		if (search->stop){
+			break;
+		}
+		for (int i = 0; i < numOfLines; i++){
+			lines[i] = iterationLines[i];
+		}
+		if (isTimeUp(search, startTime, timePerMove)){
+			break;
+		}
+	}
+	search->excluded = NULL;
+	search->numOfExcluded = 0;
+	stopSearch(search, numOfHelpers);
+	return numOfLines;
+}
+
+/*
+ * Seeds the random numbers the threads break ties with, so that the moves of a search
+ * depend only on the seed (when it is searched by a single thread to a fixed depth).
+ */
+void Search_seed(struct Search* search, uint64_t seed){
+	for (int i = 0; i < search->numOfThreads; i++){
+		search->threads[i].randomState = 0x9E3779B97F4A7C15ULL * (seed*Search_MAX_THREADS + i + 1);
+	}
+}
+
+/*
+ * Stops a search that runs in another thread, which then returns the best move found so far.
+ * The request stands until Search_resetStop is called, so a search that has yet to start
+ * returns as soon as it starts, and so does any search after it.
+ */
+void Search_stop(struct Search* search){
+	search->isStopRequested = 1;
+	search->stop = 1;
+}
+
+/*
+ * Withdraws the requests of Search_stop. To be called before a search that may be stopped
+ * is started in another thread, while no search is running.
+ */
+void Search_resetStop(struct Search* search){
+	search->isStopRequested = 0;
+}
+
+/*
+ * Forgets what the previous searches have learned, the transposition table and the move
+ * ordering heuristics, so that the following searches are as they would be in a new game.
+ */
+void Search_clear(struct Search* search){
+	TranspositionTable_clear(search->table);
+	for (int i = 0; i < search->numOfThreads; i++){
+		MoveOrdering_clear(&search->threads[i].ordering);
+	}
+}
+
+/*
+ * Sets the late move reductions of the following searches.
+ */
+void Search_setReductions(struct Search* search, struct Reductions reductions){
+	search->reductions = reductions;
+}
+
+/*
+ * @return: the number of nodes searched by all the threads during the last search,
+ *          including the nodes of the quiescence search
+ */
+long Search_nodes(struct Search* search){
+	long nodes = 0;
+	for (int i = 0; i < search->numOfThreads; i++){
+		nodes += search->threads[i].nodes + search->threads[i].quiescenceNodes;
+	}
+	return nodes;
+}
+
+/*
+ * @return: the number of nodes searched by all the threads in the quiescence search during the last search
+ */
+long Search_quiescenceNodes(struct Search* search){
+	long nodes = 0;
+	for (int i = 0; i < search->numOfThreads; i++){
+		nodes += search->threads[i].quiescenceNodes;
+	}
+	return nodes;
+}
+
+/*
+ * Frees the structure. The transposition table is not freed.
+ */
+void Search_free(struct Search* search){
+	free(search->threads);
+	free(search);
+}
\ No newline at end of file
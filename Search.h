@@ -0,0 +1,93 @@
+#include "MoveOrdering.c"
+#include <pthread.h>
+#include <time.h>
+
+#define Search_INFINITE_SCORE 1000
+#define Search_MAX_DEPTH      64
+#define Search_MAX_THREADS    64
+
+#define Search_MAX_PV_LENGTH   32
+
+#define Search_DEFAULT_REDUCTION_DEPTH 3
+#define Search_DEFAULT_REDUCTION_MOVES 3
+#define Search_DEFAULT_REDUCTION       1
+
+/*
+ * The settings of the late move reductions: quiet moves ordered late are searched to a
+ * reduced depth first, and to the full depth only if they turn out better than expected.
+ */
+struct Reductions{
+	int minDepth;   /* the least remaining depth at which moves are reduced */
+	int minMoves;   /* the number of moves searched to the full depth before the reductions start */
+	int plies;      /* the depth taken off a reduced move, 0 to turn the reductions off */
+};
+
+/*
+ * A line of play found by the search: a root move, followed by the best replies
+ * known to the transposition table, and the score of the line for the player to move.
+ */
+struct PrincipalVariation{
+	int score;
+	int length;
+	struct Move moves[Search_MAX_PV_LENGTH];
+};
+
+/*
+ * The state of a single search thread. Every thread searches its own copy of the board,
+ * with its own move ordering heuristics and its own random numbers for breaking ties.
+ */
+struct SearchThread{
+	struct Search* search;
+	struct Board board;
+	struct MoveOrdering ordering;
+	uint64_t randomState;
+	long nodes;             /* the nodes of the main search */
+	long quiescenceNodes;   /* the nodes of the quiescence search at its leaves */
+	int id;
+	pthread_t handle;
+};
+
+/*
+ * A Lazy SMP search: all the threads search the same root position, sharing their results
+ * only through the transposition table. The helper threads start at staggered depths, so that
+ * they fill the table with results the main thread will need, and the main thread reports the move.
+ */
+struct Search{
+	struct TranspositionTable* table;
+	struct SearchThread* threads;
+	int numOfThreads;
+	int player;
+	int maxDepth;
+	struct Reductions reductions;
+	struct PrincipalVariation* excluded; /* during a multi-PV search, the lines whose root moves are skipped, NULL otherwise */
+	int numOfExcluded;
+	long deadline;      /* 0 while the main thread may not be interrupted */
+	volatile int stop;  /* set once the search is over, polled by all the threads */
+	volatile int isStopRequested; /* set by Search_stop, until Search_resetStop */
+	void (*report)(struct Search* search, int depth, int score, struct PrincipalVariation* line); /* NULL for no reports */
+};
+
+long Search_currentTimeMillis();
+
+struct Search* Search_new(struct TranspositionTable* table, int numOfThreads);
+
+struct Move Search_bestMove(struct Search* search, struct Board* board, int player, int maxDepth, long timePerMove);
+
+int Search_multiPV(struct Search* search, struct Board* board, int player, int numOfLines, int maxDepth, long timePerMove,
+		struct PrincipalVariation* lines);
+
+void Search_setReductions(struct Search* search, struct Reductions reductions);
+
+void Search_seed(struct Search* search, uint64_t seed);
+
+void Search_stop(struct Search* search);
+
+void Search_resetStop(struct Search* search);
+
+void Search_clear(struct Search* search);
+
+long Search_nodes(struct Search* search);
+
+long Search_quiescenceNodes(struct Search* search);
+
+void Search_free(struct Search* search);
\ No newline at end of file
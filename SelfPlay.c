@@ -0,0 +1,66 @@
+#include "SelfPlay.h"
+
+/*
+ * A game of the batch, as a job of the worker pool.
+ */
+struct GameJob{
+	long index;
+	struct Game game;
+};
+
+/*
+ * Takes the next game to be played.
+ *
+ * @return: 1 (true) if a game was taken, 0 (false) if all the games were taken
+ */
+static int takeGame(void* batch, void* job){
+	struct SelfPlay* selfPlay = (struct SelfPlay*)batch;
+	if (selfPlay->nextGame == selfPlay->numOfGames){
+		return 0;
+	}
+	((struct GameJob*)job)->index = selfPlay->nextGame++;
+	return 1;
+}
+
+/*
+ * Plays a game.
+ */
+static void playGame(void* batch, struct Search* search, void* job){
+	struct SelfPlay* selfPlay = (struct SelfPlay*)batch;
+	struct GameJob* gameJob = (struct GameJob*)job;
+	Search_clear(search);
+	Game_play(&gameJob->game, search, selfPlay->book, selfPlay->maxDepth, selfPlay->timePerMove,
+			selfPlay->numOfRandomPlies, selfPlay->seed + gameJob->index);
+}
+
+/*
+ * Writes the record of a game that was played.
+ */
+static void finishGame(void* batch, void* job){
+	struct SelfPlay* selfPlay = (struct SelfPlay*)batch;
+	struct Game* game = &((struct GameJob*)job)->game;
+	Game_write(game, selfPlay->file);
+	fflush(selfPlay->file);
+	selfPlay->results[game->result]++;
+}
+
+/*
+ * Plays a batch of games, and waits for all of them to end.
+ *
+ * @params: (selfPlay) - the batch, whose settings must be filled in
+ *          (numOfThreads) - the number of threads in the pool, between 1 to WorkerPool_MAX_THREADS
+ * @return: the number of games played, or -1 if not all of them could be played
+ */
+long SelfPlay_run(struct SelfPlay* selfPlay, int numOfThreads){
+	struct WorkerPool pool = {selfPlay, sizeof(struct GameJob), selfPlay->hashSize, &takeGame, &playGame, &finishGame};
+	selfPlay->nextGame = 0;
+	for (int result = 0; result < 4; result++){
+		selfPlay->results[result] = 0;
+	}
+	WorkerPool_run(&pool, numOfThreads);
+	long numOfPlayed = 0;
+	for (int result = 0; result < 4; result++){
+		numOfPlayed += selfPlay->results[result];
+	}
+	return (numOfPlayed == selfPlay->numOfGames)? numOfPlayed : -1;
+}
@@ -0,0 +1,24 @@
+#include "WorkerPool.c"
+
+/*
+ * A batch of games of the computer against itself, played concurrently by a worker pool.
+ * Game i is seeded with seed+i, and is played from a cleared search, so its moves don't
+ * depend on the thread that played it or on the order the games were played in (as long as
+ * the search has no time limit). The records are written to the file as soon as the games end,
+ * in the order they ended.
+ */
+struct SelfPlay{
+	long numOfGames;
+	int maxDepth;
+	long timePerMove;       /* in milliseconds, 0 for no limit */
+	int numOfRandomPlies;   /* the plies played at random at the start of every game, for variety */
+	int hashSize;           /* the size of every thread's transposition table, in megabytes */
+	uint64_t seed;
+	struct Book* book;      /* NULL for no book */
+	FILE* file;
+	/* the state of the batch, shared by the threads */
+	long nextGame;
+	long results[4];        /* the number of games of every result */
+};
+
+long SelfPlay_run(struct SelfPlay* selfPlay, int numOfThreads);
@@ -0,0 +1,316 @@
+#include "Tablebase.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define NUM_OF_SQUARES 50
+#define LAST_BIT       54 /* the bit of the last square, see Board.h */
+#define NUM_OF_SIGNATURES ((Tablebase_MAX_PIECES+1)*(Tablebase_MAX_PIECES+1)*(Tablebase_MAX_PIECES+1)*(Tablebase_MAX_PIECES+1))
+
+static struct Tablebase tablebases[Tablebase_MAX_PIECES+1][Tablebase_MAX_PIECES+1][Tablebase_MAX_PIECES+1][Tablebase_MAX_PIECES+1];
+static int maxPieces = 0; /* the most pieces of any available tablebase */
+
+/*
+ * @return: the binomial coefficient (n choose k), 0 if k > n
+ */
+static long choose(int n, int k){
+	if (k < 0 || k > n){
+		return 0;
+	}
+	long result = 1;
+	for (int i = 1; i <= k; i++){
+		result = result * (n-k+i) / i;
+	}
+	return result;
+}
+
+/*
+ * @return: the tablebase of a material signature, or NULL if there are too many pieces in a group
+ */
+static struct Tablebase* tablebaseOf(const int counts[4]){
+	for (int group = 0; group < 4; group++){
+		if (counts[group] > Tablebase_MAX_PIECES){
+			return NULL;
+		}
+	}
+	return &tablebases[counts[0]][counts[1]][counts[2]][counts[3]];
+}
+
+/*
+ * Finds the material signature of a number, so that all the signatures can be gone over
+ * with a single loop, from 0 to NUM_OF_SIGNATURES.
+ *
+ * @params: (signature) - the number of the signature
+ *          (counts) - the array to which the signature will be written
+ * @return: the total number of pieces of the signature
+ */
+static int signatureOf(int signature, int counts[4]){
+	int numOfPieces = 0;
+	for (int group = 0; group < 4; group++){
+		counts[group] = signature % (Tablebase_MAX_PIECES+1);
+		signature /= Tablebase_MAX_PIECES+1;
+		numOfPieces += counts[group];
+	}
+	return numOfPieces;
+}
+
+/*
+ * Writes the number of pieces in every group of a position.
+ */
+static void countPieces(const uint64_t pieces[4], int counts[4]){
+	for (int group = 0; group < 4; group++){
+		counts[group] = bitCount(pieces[group]);
+	}
+}
+
+/*
+ * @return: the number of positions with white to move of a material signature
+ */
+long Tablebase_numOfPositions(const int counts[4]){
+	long numOfPositions = 1;
+	int numOfFreeSquares = NUM_OF_SQUARES;
+	for (int group = 0; group < 4; group++){
+		numOfPositions *= choose(numOfFreeSquares, counts[group]);
+		numOfFreeSquares -= counts[group];
+	}
+	return numOfPositions;
+}
+
+/*
+ * Computes the index of a position with white to move in the tablebase of its material signature.
+ *
+ * @params: (pieces) - the masks of the groups of pieces
+ * @return: the index of the position
+ */
+long Tablebase_index(const uint64_t pieces[4]){
+	uint64_t occupied = 0;
+	long index = 0;
+	for (int group = 0; group < 4; group++){
+		uint64_t universe = Board_VALID_SQUARES & ~occupied;
+		long rank = 0;
+		int i = 0;
+		for (uint64_t bits = pieces[group]; bits; bits &= bits - 1, i++){
+			int position = bitCount(universe & ((1ULL << bitScan(bits)) - 1));
+			rank += choose(position, i+1);
+		}
+		index = index * choose(bitCount(universe), i) + rank;
+		occupied |= pieces[group];
+	}
+	return index;
+}
+
+/*
+ * Computes the position of an index in the tablebase of a material signature, the inverse of Tablebase_index.
+ *
+ * @params: (counts) - the material signature
+ *          (index) - the index of the position
+ *          (pieces) - the array to which the masks of the groups of pieces will be written
+ */
+void Tablebase_placement(const int counts[4], long index, uint64_t pieces[4]){
+	long ranks[4];
+	int numOfFreeSquares = NUM_OF_SQUARES;
+	for (int group = 0; group < 3; group++){
+		numOfFreeSquares -= counts[group];
+	}
+	for (int group = 3; group >= 0; group--){
+		long numOfRanks = choose(numOfFreeSquares, counts[group]);
+		ranks[group] = index % numOfRanks;
+		index /= numOfRanks;
+		if (group > 0){
+			numOfFreeSquares += counts[group-1];
+		}
+	}
+	uint64_t occupied = 0;
+	for (int group = 0; group < 4; group++){
+		uint64_t universe = Board_VALID_SQUARES & ~occupied;
+		pieces[group] = 0;
+		int position = bitCount(universe);
+		for (int i = counts[group]; i > 0; i--){
+			do{
+				position--;
+			} while (choose(position, i) > ranks[group]);
+			ranks[group] -= choose(position, i);
+			uint64_t squares = universe;
+			for (int j = 0; j < position; j++){
+				squares &= squares - 1;
+			}
+			pieces[group] |= squares & -squares;
+		}
+		occupied |= pieces[group];
+	}
+}
+
+/*
+ * Turns a position around: the board is rotated by 180 degrees and the colors are swapped,
+ * so that a position with black to move becomes the same position with white to move.
+ * A rotated square's bit is LAST_BIT minus its bit, which also maps the ghost bits to ghost bits.
+ *
+ * @params: (pieces) - the masks of the groups of pieces
+ *          (rotated) - the array to which the masks of the rotated position will be written
+ */
+void Tablebase_rotate(const uint64_t pieces[4], uint64_t rotated[4]){
+	for (int group = 0; group < 4; group++){
+		uint64_t mask = 0;
+		for (uint64_t bits = pieces[group]; bits; bits &= bits - 1){
+			mask |= 1ULL << (LAST_BIT - bitScan(bits));
+		}
+		rotated[(group+2)%4] = mask;
+	}
+}
+
+/*
+ * Writes the name of the file of a material signature's tablebase: the four counts, in the
+ * order of the groups, with the extension ".tb".
+ *
+ * @params: (directory) - the directory of the file
+ *          (name) - the buffer to which the name is written
+ *          (length) - the size of the buffer
+ */
+void Tablebase_fileName(const int counts[4], const char* directory, char* name, size_t length){
+	snprintf(name, length, "%s/%d%d%d%d.tb", directory, counts[0], counts[1], counts[2], counts[3]);
+}
+
+/*
+ * Makes a tablebase held in memory available, in place of the file of its material signature.
+ * The memory must stay valid until the tablebases are closed.
+ *
+ * @params: (counts) - the material signature
+ *          (data) - the values of all of its positions
+ */
+void Tablebase_register(const int counts[4], const unsigned char* data){
+	struct Tablebase* tablebase = tablebaseOf(counts);
+	tablebase->data = data;
+	tablebase->size = Tablebase_numOfPositions(counts);
+	tablebase->isMapped = 0;
+	int numOfPieces = counts[0] + counts[1] + counts[2] + counts[3];
+	if (numOfPieces > maxPieces){
+		maxPieces = numOfPieces;
+	}
+}
+
+/*
+ * Looks up the value of a position with white to move.
+ *
+ * @params: (pieces) - the masks of the groups of pieces
+ * @return: the value of the position as it is stored, or -1 if its tablebase isn't available
+ */
+int Tablebase_lookup(const uint64_t pieces[4]){
+	int counts[4];
+	countPieces(pieces, counts);
+	if (counts[Tablebase_WHITE_MEN] + counts[Tablebase_WHITE_KINGS] == 0){
+		return 1; // white has no pieces left, so it has no move and lost
+	}
+	struct Tablebase* tablebase = tablebaseOf(counts);
+	if (tablebase == NULL || tablebase->data == NULL){
+		return -1;
+	}
+	return tablebase->data[Tablebase_index(pieces)];
+}
+
+/*
+ * Maps the files of all the tablebases found in a directory to memory, read only, so that
+ * all the threads and processes probing the same files share their pages. The tablebases found
+ * take the place of all the ones available before; if none are found, those are kept.
+ *
+ * @params: (directory) - the directory of the files
+ * @return: the number of tablebases found
+ */
+int Tablebase_open(const char* directory){
+	const unsigned char** found = (const unsigned char**)calloc(NUM_OF_SIGNATURES, sizeof(const unsigned char*));
+	if (found == NULL){
+		return 0;
+	}
+	int numOfFound = 0;
+	for (int signature = 0; signature < NUM_OF_SIGNATURES; signature++){
+		int counts[4];
+		if (signatureOf(signature, counts) > Tablebase_MAX_PIECES){
+			continue;
+		}
+		char name[1024];
+		Tablebase_fileName(counts, directory, name, sizeof(name));
+		int file = open(name, O_RDONLY);
+		if (file < 0){
+			continue;
+		}
+		struct stat status;
+		size_t size = Tablebase_numOfPositions(counts);
+		if (fstat(file, &status) != 0 || (size_t)status.st_size != size){ // not a tablebase of this signature
+			close(file);
+			continue;
+		}
+		void* data = mmap(NULL, size, PROT_READ, MAP_SHARED, file, 0);
+		close(file);
+		if (data == MAP_FAILED){
+			continue;
+		}
+		found[signature] = (const unsigned char*)data;
+		numOfFound++;
+	}
+	if (numOfFound > 0){
+		Tablebase_close();
+		for (int signature = 0; signature < NUM_OF_SIGNATURES; signature++){
+			if (found[signature] != NULL){
+				int counts[4];
+				signatureOf(signature, counts);
+				Tablebase_register(counts, found[signature]);
+				tablebaseOf(counts)->isMapped = 1;
+			}
+		}
+	}
+	free(found);
+	return numOfFound;
+}
+
+/*
+ * Probes the tablebases for the score of a board.
+ *
+ * @params: (player) - the player to move, whose point of view the score is from
+ *          (score) - a pointer to which the score will be written: Tablebase_DRAW for a draw,
+ *                    and for a win Tablebase_WIN_SCORE minus the number of plies it takes
+ *                    (but at least half of it), negated for a loss
+ * @return: 1 (true) if the board was found, 0 (false) otherwise
+ */
+int Tablebase_probe(struct Board* board, int player, int* score){
+	uint64_t all = board->men[WHITE] | board->kings[WHITE] | board->men[BLACK] | board->kings[BLACK];
+	if (bitCount(all) > maxPieces){
+		return 0;
+	}
+	uint64_t pieces[4] = {board->men[WHITE], board->kings[WHITE], board->men[BLACK], board->kings[BLACK]};
+	if (player == BLACK){
+		uint64_t rotated[4];
+		Tablebase_rotate(pieces, rotated);
+		for (int group = 0; group < 4; group++){
+			pieces[group] = rotated[group];
+		}
+	}
+	int value = Tablebase_lookup(pieces);
+	if (value < 0 || value == Tablebase_INVALID){
+		return 0;
+	}
+	if (value == Tablebase_DRAW){
+		*score = 0;
+		return 1;
+	}
+	int plies = value - 1;
+	int distance = (plies < Tablebase_WIN_SCORE/2)? plies : Tablebase_WIN_SCORE/2;
+	*score = (plies % 2)? Tablebase_WIN_SCORE - distance : distance - Tablebase_WIN_SCORE;
+	return 1;
+}
+
+/*
+ * Unmaps all the mapped tablebases, and forgets the ones held in memory.
+ */
+void Tablebase_close(){
+	for (int signature = 0; signature < NUM_OF_SIGNATURES; signature++){
+		int counts[4];
+		signatureOf(signature, counts);
+		struct Tablebase* tablebase = tablebaseOf(counts);
+		if (tablebase->isMapped){
+			munmap((void*)tablebase->data, tablebase->size);
+		}
+		tablebase->data = NULL;
+		tablebase->isMapped = 0;
+	}
+	maxPieces = 0;
+}
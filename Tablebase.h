@@ -0,0 +1,50 @@
+#include "Board.c"
+#include <stddef.h>
+#include <stdint.h>
+
+#define Tablebase_MAX_PIECES 6
+#define Tablebase_WIN_SCORE  99 /* the score of a win in the least number of plies, less than an actual win (100) */
+#define Tablebase_DRAW       0
+#define Tablebase_INVALID    0xFF
+
+/* the groups of pieces a position is made of, in the order of the arrays below */
+#define Tablebase_WHITE_MEN   0
+#define Tablebase_WHITE_KINGS 1
+#define Tablebase_BLACK_MEN   2
+#define Tablebase_BLACK_KINGS 3
+
+/*
+ * The tablebase of one material signature: the number of pieces in every group.
+ * Only positions with white to move are kept; a position with black to move is looked up
+ * rotated by 180 degrees with the colors swapped, which is the same position for white.
+ * Every position is a single byte: Tablebase_DRAW, or n+1 if the game ends n plies from it
+ * with perfect play, which is a win for the player to move if n is odd and a loss if n is even.
+ * Placements with a man on its crowning row never occur, and are Tablebase_INVALID.
+ * A position's index is a perfect index of its placement: each group is ranked among the
+ * squares left by the groups before it, as a combination in colexicographic order.
+ */
+struct Tablebase{
+	const unsigned char* data;  /* NULL if the tablebase isn't available */
+	size_t size;
+	int isMapped;               /* 1 if the data is a mapped file, 0 if it belongs to the caller */
+};
+
+long Tablebase_numOfPositions(const int counts[4]);
+
+long Tablebase_index(const uint64_t pieces[4]);
+
+void Tablebase_placement(const int counts[4], long index, uint64_t pieces[4]);
+
+void Tablebase_rotate(const uint64_t pieces[4], uint64_t rotated[4]);
+
+void Tablebase_fileName(const int counts[4], const char* directory, char* name, size_t length);
+
+void Tablebase_register(const int counts[4], const unsigned char* data);
+
+int  Tablebase_lookup(const uint64_t pieces[4]);
+
+int  Tablebase_open(const char* directory);
+
+int  Tablebase_probe(struct Board* board, int player, int* score);
+
+void Tablebase_close();
@@ -0,0 +1,436 @@
+#define _POSIX_C_SOURCE 199309L /* for clock_gettime */
+#include "Perft.c"
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#define MAX_THREADS 64
+#define MAX_PLIES   (Tablebase_INVALID-2) /* the longest distance a value can hold */
+#define DEFAULT_DIRECTORY "tablebases"
+
+/*
+ * A standalone tablebase generator. Generates the tablebases of all the material signatures of
+ * up to a given number of pieces, by retrograde analysis, one distance (level) at a time:
+ * the positions whose player to move has no move are lost in 0 plies; the positions with a move
+ * to a position lost in n-1 plies are won in n; and the positions whose moves all lead to positions
+ * won in at most n-1 plies are lost in n. Once a level finds nothing, whatever is left is a draw.
+ *
+ * Moves that capture or crown lead to signatures with fewer pieces or fewer men, so the signatures
+ * are generated in that order, and such moves are looked up once, when a signature starts. The other
+ * moves stay within the signature and its mirror image (the colors swapped), so the two are generated
+ * together: the positions found at a level are taken back one move, to the positions that move to them,
+ * and only those are updated. Every pass over the positions is split between the threads.
+ *
+ * Usage: tablebase <pieces> [threads] [directory]
+ */
+
+#define INITIAL_PASS   0
+#define PROPAGATE_PASS 1
+#define PENDING_PASS   2
+
+/*
+ * The tablebases of a signature and of its mirror image, while they are generated.
+ */
+struct Generation{
+	int counts[2][4];
+	unsigned char* values[2];
+	unsigned char* counters[2]; /* the moves of a position not yet known to lead to a win of the opponent */
+	unsigned char* pending[2];  /* the level the moves leaving the signature decide a position at:
+	                               odd for a win, even for the earliest loss, 0 for none */
+	long numOfPositions[2];
+	int numOfTables;            /* 1 if the signature is its own mirror image, 2 otherwise */
+	int level;                  /* the distance of the positions found by the current pass */
+	int pass;
+};
+
+struct Worker{
+	struct Generation* generation;
+	int id;
+	int numOfWorkers;
+	long found;
+	pthread_t handle;
+};
+
+#ifndef __GNUC__
+static pthread_mutex_t counterLock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+/*
+ * Decrements a counter shared by the threads.
+ *
+ * @return: the new value of the counter
+ */
+static int decrement(unsigned char* counter){
+#ifdef __GNUC__
+	return __sync_sub_and_fetch(counter, 1);
+#else
+	pthread_mutex_lock(&counterLock);
+	int value = --*counter;
+	pthread_mutex_unlock(&counterLock);
+	return value;
+#endif
+}
+
+/*
+ * Sets up the board of a position with white to move.
+ */
+static void setUpBoard(struct Board* board, const uint64_t pieces[4]){
+	Board_clear(board);
+	togglePieces(board, pieces[Tablebase_WHITE_MEN], WHITE, 0);
+	togglePieces(board, pieces[Tablebase_WHITE_KINGS], WHITE, 1);
+	togglePieces(board, pieces[Tablebase_BLACK_MEN], BLACK, 0);
+	togglePieces(board, pieces[Tablebase_BLACK_KINGS], BLACK, 1);
+}
+
+/*
+ * Looks up the value of the position on a board with black to move.
+ *
+ * @return: the stored value of the position, or Tablebase_DRAW if it is unknown
+ */
+static int valueOfBlackToMove(struct Board* board){
+	uint64_t pieces[4] = {board->men[WHITE], board->kings[WHITE], board->men[BLACK], board->kings[BLACK]};
+	uint64_t rotated[4];
+	Tablebase_rotate(pieces, rotated);
+	int value = Tablebase_lookup(rotated);
+	return (value < 0 || value == Tablebase_INVALID)? Tablebase_DRAW : value;
+}
+
+/*
+ * Prepares a position for the levels: marks it if it never occurs, finds it lost if white has no
+ * move, and otherwise counts its moves that stay within the signature, and looks up the others.
+ *
+ * @return: 1 (true) if the position was found lost, 0 (false) otherwise
+ */
+static int initPosition(struct Generation* generation, int table, long index){
+	uint64_t pieces[4];
+	Tablebase_placement(generation->counts[table], index, pieces);
+	if ((pieces[Tablebase_WHITE_MEN] & Board_ROW_10) || (pieces[Tablebase_BLACK_MEN] & Board_ROW_1)){
+		generation->values[table][index] = Tablebase_INVALID;
+		return 0;
+	}
+	struct Board board;
+	struct MoveList possibleMoves;
+	struct MoveUndo undo;
+	setUpBoard(&board, pieces);
+	Board_generateMoves(&board, WHITE, &possibleMoves);
+	if (possibleMoves.length == 0){
+		generation->values[table][index] = 1;
+		return 1;
+	}
+	int counter = 0;
+	int hasDraw = 0;
+	int shortestLoss = -1; // of the opponent
+	int longestWin = -1;   // of the opponent
+	for (int i = 0; i < possibleMoves.length; i++){
+		struct Move* move = &possibleMoves.moves[i];
+		Board_makeMove(&board, move, &undo);
+		if (move->captured == 0 && !undo.promoted){
+			counter++;
+		}
+		else{
+			int value = valueOfBlackToMove(&board);
+			int plies = value - 1;
+			if (value == Tablebase_DRAW){
+				hasDraw = 1;
+			}
+			else if (plies % 2 == 0 && (shortestLoss < 0 || plies < shortestLoss)){
+				shortestLoss = plies;
+			}
+			else if (plies % 2 == 1 && plies > longestWin){
+				longestWin = plies;
+			}
+		}
+		Board_unmakeMove(&board, move, &undo);
+	}
+	generation->counters[table][index] = counter + hasDraw; /* a draw is never found to be a win */
+	generation->pending[table][index] = (shortestLoss >= 0)? shortestLoss+1 : longestWin+1;
+	return 0;
+}
+
+/*
+ * Updates a position that has a move to a position just found.
+ *
+ * @params: (pieces) - the position to be updated, with white to move
+ *          (table) - the table of the position
+ * @return: 1 (true) if the position was found, 0 (false) otherwise
+ */
+static int updatePredecessor(struct Generation* generation, const uint64_t pieces[4], int table){
+	struct Board board;
+	setUpBoard(&board, pieces);
+	if (Board_hasPossibleJump(&board, WHITE)){ // the move would not have been possible
+		return 0;
+	}
+	long index = Tablebase_index(pieces);
+	int level = generation->level;
+	if (generation->values[table][index] != Tablebase_DRAW){
+		return 0;
+	}
+	if (level % 2){ // it moves to a position lost in (level-1)
+		generation->values[table][index] = level+1;
+		return 1;
+	}
+	int pending = generation->pending[table][index];
+	if (decrement(&generation->counters[table][index]) == 0 && pending % 2 == 0 && pending <= level){
+		generation->values[table][index] = level+1;
+		return 1;
+	}
+	return 0;
+}
+
+/*
+ * Takes back every move that leads to a position found at the previous level, and updates the
+ * positions it is taken back to. Only moves that stay within the signature are taken back: a man
+ * steps back without leaving its crowning row behind, and a king slides back along any ray.
+ *
+ * @return: the number of positions found
+ */
+static int propagate(struct Generation* generation, int table, long index){
+	uint64_t found[4];
+	uint64_t pieces[4];
+	Tablebase_placement(generation->counts[table], index, found);
+	Tablebase_rotate(found, pieces); // black to move, after the move of white that is taken back
+	int predecessorTable = (generation->numOfTables == 1)? 0 : 1-table;
+	uint64_t empty = Board_VALID_SQUARES & ~(pieces[0] | pieces[1] | pieces[2] | pieces[3]);
+	int numOfFound = 0;
+	for (uint64_t men = pieces[Tablebase_WHITE_MEN]; men; men &= men - 1){
+		uint64_t man = men & -men;
+		for (int direction = DOWN_RIGHT; direction <= DOWN_LEFT; direction++){
+			uint64_t from = neighbourMasks[bitScan(man)][direction] & empty;
+			if (from){
+				pieces[Tablebase_WHITE_MEN] ^= man | from;
+				numOfFound += updatePredecessor(generation, pieces, predecessorTable);
+				pieces[Tablebase_WHITE_MEN] ^= man | from;
+			}
+		}
+	}
+	for (uint64_t kings = pieces[Tablebase_WHITE_KINGS]; kings; kings &= kings - 1){
+		uint64_t king = kings & -kings;
+		for (int direction = 0; direction < 4; direction++){
+			const signed char* ray = rays[bitScan(king)][direction];
+			for (int i = 0; ray[i] >= 0 && (empty & (1ULL << ray[i])); i++){
+				uint64_t from = 1ULL << ray[i];
+				pieces[Tablebase_WHITE_KINGS] ^= king | from;
+				numOfFound += updatePredecessor(generation, pieces, predecessorTable);
+				pieces[Tablebase_WHITE_KINGS] ^= king | from;
+			}
+		}
+	}
+	return numOfFound;
+}
+
+/*
+ * Finds a position at the current level because of its moves that leave the signature.
+ *
+ * @return: 1 (true) if the position was found, 0 (false) otherwise
+ */
+static int resolvePending(struct Generation* generation, int table, long index){
+	int level = generation->level;
+	if (generation->pending[table][index] != level || (level % 2 == 0 && generation->counters[table][index] != 0)){
+		return 0;
+	}
+	generation->values[table][index] = level+1;
+	return 1;
+}
+
+/*
+ * The procedure of the threads: a single pass over their share of the positions.
+ */
+static void* runPass(void* data){
+	struct Worker* worker = (struct Worker*)data;
+	struct Generation* generation = worker->generation;
+	worker->found = 0;
+	for (int table = 0; table < generation->numOfTables; table++){
+		unsigned char* values = generation->values[table];
+		long numOfPositions = generation->numOfPositions[table];
+		long blockSize = numOfPositions / worker->numOfWorkers + 1;
+		long end = (worker->id + 1) * blockSize;
+		for (long index = worker->id * blockSize; index < numOfPositions && index < end; index++){
+			switch (generation->pass){
+				case INITIAL_PASS:
+					worker->found += initPosition(generation, table, index);
+					break;
+				case PROPAGATE_PASS:
+					if (values[index] == generation->level){ // found at the previous level
+						worker->found += propagate(generation, table, index);
+					}
+					break;
+				default:
+					if (values[index] == Tablebase_DRAW){
+						worker->found += resolvePending(generation, table, index);
+					}
+					break;
+			}
+		}
+	}
+	return NULL;
+}
+
+/*
+ * Runs a single pass with all the threads.
+ *
+ * @return: the number of positions found, or -1 if a thread could not be started
+ */
+static long runParallelPass(struct Generation* generation, int pass, struct Worker* workers, int numOfWorkers){
+	int started = 0;
+	long found = 0;
+	generation->pass = pass;
+	for (; started < numOfWorkers; started++){
+		workers[started].generation = generation;
+		workers[started].id = started;
+		workers[started].numOfWorkers = numOfWorkers;
+		if (pthread_create(&workers[started].handle, NULL, &runPass, &workers[started]) != 0){
+			break;
+		}
+	}
+	for (int i = 0; i < started; i++){
+		pthread_join(workers[i].handle, NULL);
+		found += workers[i].found;
+	}
+	return (started == numOfWorkers)? found : -1;
+}
+
+/*
+ * Writes a generated tablebase to its file, and prints how its positions came out.
+ *
+ * @return: 0 on success, -1 if the file could not be written
+ */
+static int writeTablebase(const int counts[4], const unsigned char* values, long numOfPositions, const char* directory){
+	long wins = 0, losses = 0, draws = 0;
+	int longest = 0;
+	for (long index = 0; index < numOfPositions; index++){
+		int value = values[index];
+		if (value == Tablebase_DRAW){
+			draws++;
+		}
+		else if (value != Tablebase_INVALID){
+			if (value % 2){
+				losses++;
+			}
+			else{
+				wins++;
+			}
+			if (value-1 > longest){
+				longest = value-1;
+			}
+		}
+	}
+	printf("%d%d%d%d: %ld positions, %ld wins, %ld losses, %ld draws, longest %d plies\n",
+			counts[0], counts[1], counts[2], counts[3], wins + losses + draws, wins, losses, draws, longest);
+	char name[1024];
+	Tablebase_fileName(counts, directory, name, sizeof(name));
+	FILE* file = fopen(name, "wb");
+	if (file == NULL){
+		return -1;
+	}
+	size_t written = fwrite(values, 1, numOfPositions, file);
+	if (fclose(file) != 0 || written != (size_t)numOfPositions){
+		return -1;
+	}
+	return 0;
+}
+
+/*
+ * Generates the tablebases of a signature and of its mirror image, and writes them.
+ * They stay registered, so that the signatures generated after them can look them up.
+ *
+ * @params: (maxPlies) - the longest distance found so far, in any signature
+ * @return: the longest distance found so far, or -1 if any error occurred
+ */
+static int generate(const int counts[4], struct Worker* workers, int numOfWorkers, const char* directory, int maxPlies){
+	struct Generation generation;
+	int mirror[4] = {counts[2], counts[3], counts[0], counts[1]};
+	int isSymmetric = counts[0] == counts[2] && counts[1] == counts[3];
+	int failed = 0;
+	generation.numOfTables = isSymmetric? 1 : 2;
+	for (int table = 0; table < generation.numOfTables; table++){
+		const int* signature = (table == 0)? counts : mirror;
+		memcpy(generation.counts[table], signature, sizeof(generation.counts[table]));
+		generation.numOfPositions[table] = Tablebase_numOfPositions(signature);
+		generation.values[table] = (unsigned char*)calloc(generation.numOfPositions[table], 1);
+		generation.counters[table] = (unsigned char*)calloc(generation.numOfPositions[table], 1);
+		generation.pending[table] = (unsigned char*)calloc(generation.numOfPositions[table], 1);
+		if (!generation.values[table] || !generation.counters[table] || !generation.pending[table]){
+			return -1;
+		}
+		Tablebase_register(signature, generation.values[table]);
+	}
+	generation.level = 0;
+	int lastFound = 0;
+	if (runParallelPass(&generation, INITIAL_PASS, workers, numOfWorkers) < 0){
+		failed = 1;
+	}
+	for (generation.level = 1; generation.level <= MAX_PLIES && !failed; generation.level++){
+		long propagated = runParallelPass(&generation, PROPAGATE_PASS, workers, numOfWorkers);
+		long resolved = runParallelPass(&generation, PENDING_PASS, workers, numOfWorkers);
+		if (propagated < 0 || resolved < 0){
+			failed = 1;
+		}
+		if (propagated + resolved > 0){
+			lastFound = generation.level;
+		}
+		/* the moves leaving the signature decide positions up to one ply beyond the longest distance
+		 * of the signatures before it, and the positions of a level decide others only at the next level */
+		if (generation.level > maxPlies + 1 && generation.level > lastFound + 1){
+			break;
+		}
+	}
+	if (lastFound > maxPlies){
+		maxPlies = lastFound;
+	}
+	for (int table = 0; table < generation.numOfTables; table++){
+		free(generation.counters[table]);
+		free(generation.pending[table]);
+		if (!failed && writeTablebase(generation.counts[table], generation.values[table], generation.numOfPositions[table], directory) != 0){
+			failed = 1;
+		}
+	}
+	return failed? -1 : maxPlies;
+}
+
+int main(int argc, char* argv[]){
+	if (argc < 2 || argc > 4){
+		fprintf(stderr, "Usage: %s <pieces> [threads] [directory]\n", argv[0]);
+		return 1;
+	}
+	int maxPieces = strtol(argv[1], NULL, 10);
+	int numOfWorkers = (argc > 2)? strtol(argv[2], NULL, 10) : 1;
+	const char* directory = (argc > 3)? argv[3] : DEFAULT_DIRECTORY;
+	if (maxPieces < 2 || maxPieces > Tablebase_MAX_PIECES){
+		fprintf(stderr, "The number of pieces should be between 2 to %d\n", Tablebase_MAX_PIECES);
+		return 1;
+	}
+	if (numOfWorkers < 1 || numOfWorkers > MAX_THREADS){
+		fprintf(stderr, "The number of threads should be between 1 to %d\n", MAX_THREADS);
+		return 1;
+	}
+	if (mkdir(directory, 0755) != 0 && errno != EEXIST){
+		fprintf(stderr, "Error: cannot create the directory %s\n", directory);
+		return 1;
+	}
+	struct Worker workers[MAX_THREADS];
+	int isGenerated[Tablebase_MAX_PIECES+1][Tablebase_MAX_PIECES+1][Tablebase_MAX_PIECES+1][Tablebase_MAX_PIECES+1] = {{{{0}}}};
+	int maxPlies = 0;
+	long startTime = Search_currentTimeMillis();
+	for (int numOfPieces = 2; numOfPieces <= maxPieces; numOfPieces++){
+		for (int numOfMen = 0; numOfMen <= numOfPieces; numOfMen++){
+			for (int whiteMen = 0; whiteMen <= numOfMen; whiteMen++){
+				for (int whiteKings = 0; whiteKings <= numOfPieces - numOfMen; whiteKings++){
+					int counts[4] = {whiteMen, whiteKings, numOfMen - whiteMen, numOfPieces - numOfMen - whiteKings};
+					if (counts[0] + counts[1] == 0 || counts[2] + counts[3] == 0 || isGenerated[counts[0]][counts[1]][counts[2]][counts[3]]){
+						continue;
+					}
+					maxPlies = generate(counts, workers, numOfWorkers, directory, maxPlies);
+					if (maxPlies < 0){
+						fprintf(stderr, "Error: the tablebases of %d%d%d%d could not be generated\n", counts[0], counts[1], counts[2], counts[3]);
+						return 1;
+					}
+					isGenerated[counts[0]][counts[1]][counts[2]][counts[3]] = 1;
+					isGenerated[counts[2]][counts[3]][counts[0]][counts[1]] = 1;
+				}
+			}
+		}
+	}
+	printf("Time: %ld ms\n", Search_currentTimeMillis() - startTime);
+	return 0;
+}
@@ -0,0 +1,154 @@
+#include "TranspositionTable.h"
+#include <string.h>
+
+/*
+ * Packs the fields of an entry into a single word.
+ *
+ * @return: the packed data, which is never 0
+ */
+static uint64_t pack(int depth, int bound, int score, int bestMove, int generation){
+	if (bestMove > TranspositionTable_NO_MOVE){ // only the indices below the sentinel fit in 8 bits, a later move isn't kept
+		bestMove = TranspositionTable_NO_MOVE;
+	}
+	return (uint64_t)(uint16_t)(score + 0x8000)
+			| (uint64_t)(uint8_t)depth << 16
+			| (uint64_t)(uint8_t)bound << 24
+			| (uint64_t)(uint8_t)bestMove << 32
+			| (uint64_t)(uint8_t)generation << 40
+			| 1ULL << 48;
+}
+
+/*
+ * @return: the depth stored in packed data, 0 for an empty slot
+ */
+static int unpackDepth(uint64_t data){
+	return (int)((data >> 16) & 0xFF);
+}
+
+/*
+ * @return: the generation stored in packed data
+ */
+static int unpackGeneration(uint64_t data){
+	return (int)((data >> 40) & 0xFF);
+}
+
+/*
+ * Unpacks the fields of an entry from a single word.
+ */
+static void unpack(uint64_t data, struct TableEntry* entry){
+	entry->score = (int)(data & 0xFFFF) - 0x8000;
+	entry->depth = unpackDepth(data);
+	entry->bound = (int)((data >> 24) & 0xFF);
+	entry->bestMove = (int)((data >> 32) & 0xFF);
+}
+
+/*
+ * Creates a new, empty transposition table.
+ *
+ * @params: (megabytes) - the maximal amount of memory the table may use, rounded down to a power of two
+ * @return: NULL if any allocation errors occurred, the table otherwise
+ */
+struct TranspositionTable* TranspositionTable_new(int megabytes){
+	struct TranspositionTable* table;
+	table = (struct TranspositionTable*)calloc(1, sizeof(struct TranspositionTable));
+	if (!table){
+		return NULL;
+	}
+	uint64_t bytes = (uint64_t)megabytes << 20;
+	table->numOfBuckets = 1;
+	while (2 * table->numOfBuckets * sizeof(struct TableBucket) <= bytes){
+		table->numOfBuckets *= 2;
+	}
+	table->buckets = (struct TableBucket*)calloc(table->numOfBuckets, sizeof(struct TableBucket));
+	if (!table->buckets){
+		free(table);
+		return NULL;
+	}
+	return table;
+}
+
+/*
+ * Removes all the entries from the table.
+ */
+void TranspositionTable_clear(struct TranspositionTable* table){
+	memset(table->buckets, 0, table->numOfBuckets * sizeof(struct TableBucket));
+	table->generation = 0;
+}
+
+/*
+ * Marks the entries stored so far as older than the ones about to be stored,
+ * so that they are the first to be replaced.
+ */
+void TranspositionTable_newSearch(struct TranspositionTable* table){
+	table->generation = (table->generation + 1) & 0xFF;
+}
+
+/*
+ * @return: the bucket in which a key is stored
+ */
+static struct TableBucket* getBucket(struct TranspositionTable* table, uint64_t key){
+	return &table->buckets[key & (table->numOfBuckets - 1)];
+}
+
+/*
+ * Looks up a position in the table.
+ *
+ * @params: (key) - the hash key of the position
+ *          (entry) - a pointer to which the stored entry will be copied
+ * @return: 1 (true) if the position was found, 0 (false) otherwise
+ */
+int TranspositionTable_probe(struct TranspositionTable* table, uint64_t key, struct TableEntry* entry){
+	struct TableBucket* bucket = getBucket(table, key);
+	for (int i = 0; i < TranspositionTable_BUCKET_SIZE; i++){
+		uint64_t data = bucket->slots[i].data;
+		if ((bucket->slots[i].check ^ data) == key && unpackDepth(data) > 0){
+			unpack(data, entry);
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/*
+ * Stores a search result in the table. A previous entry of the same position is overwritten,
+ * otherwise the entry replaced is the one from the oldest search with the least depth.
+ *
+ * @params: (key) - the hash key of the position
+ *          (depth) - the depth to which the position was searched
+ *          (bound) - whether the score is exact, a lower bound or an upper bound
+ *          (score) - the score of the position
+ *          (bestMove) - the index of the best move, or TranspositionTable_NO_MOVE. An index of
+ *                       TranspositionTable_NO_MOVE or above is stored as no move.
+ */
+void TranspositionTable_store(struct TranspositionTable* table, uint64_t key, int depth, int bound, int score, int bestMove){
+	struct TableBucket* bucket = getBucket(table, key);
+	struct TableSlot* replaced = &bucket->slots[0];
+	int replacedIsCurrent = 1;
+	int replacedDepth = 0x100;
+	for (int i = 0; i < TranspositionTable_BUCKET_SIZE; i++){
+		struct TableSlot* slot = &bucket->slots[i];
+		uint64_t data = slot->data;
+		if ((slot->check ^ data) == key){
+			replaced = slot;
+			break;
+		}
+		int slotIsCurrent = (unpackGeneration(data) == table->generation);
+		int slotDepth = unpackDepth(data);
+		if ((replacedIsCurrent && !slotIsCurrent) || (replacedIsCurrent == slotIsCurrent && slotDepth < replacedDepth)){
+			replaced = slot;
+			replacedIsCurrent = slotIsCurrent;
+			replacedDepth = slotDepth;
+		}
+	}
+	uint64_t data = pack(depth, bound, score, bestMove, table->generation);
+	replaced->check = key ^ data;
+	replaced->data = data;
+}
+
+/*
+ * Frees the structure.
+ */
+void TranspositionTable_free(struct TranspositionTable* table){
+	free(table->buckets);
+	free(table);
+}
\ No newline at end of file
@@ -0,0 +1,50 @@
+#include "Tablebase.c"
+
+#define TranspositionTable_EXACT       0
+#define TranspositionTable_LOWER_BOUND 1 /* the search failed high, the score is at least this */
+#define TranspositionTable_UPPER_BOUND 2 /* the search failed low, the score is at most this */
+#define TranspositionTable_NO_MOVE     0xFF /* also the index of a 256th move, which is never stored */
+#define TranspositionTable_BUCKET_SIZE 4
+
+/*
+ * A single search result. The best move is stored as its index in the list written
+ * by Board_generateMoves, which is always generated in the same order for a position.
+ */
+struct TableEntry{
+	int score;
+	int depth;
+	int bound;
+	int bestMove;
+};
+
+/*
+ * An entry as it is kept in the table, packed into one word. The table is shared by all
+ * the search threads without locks, so the key is stored XORed with the data: if two
+ * threads write the same slot at once, the torn slot no longer matches its key.
+ */
+struct TableSlot{
+	uint64_t check; /* the key XOR the data */
+	uint64_t data;
+};
+
+struct TableBucket{
+	struct TableSlot slots[TranspositionTable_BUCKET_SIZE];
+};
+
+struct TranspositionTable{
+	struct TableBucket* buckets;
+	uint64_t numOfBuckets; /* always a power of two */
+	int generation;
+};
+
+struct TranspositionTable* TranspositionTable_new(int megabytes);
+
+void TranspositionTable_clear     (struct TranspositionTable* table);
+
+void TranspositionTable_newSearch (struct TranspositionTable* table);
+
+int  TranspositionTable_probe     (struct TranspositionTable* table, uint64_t key, struct TableEntry* entry);
+
+void TranspositionTable_store     (struct TranspositionTable* table, uint64_t key, int depth, int bound, int score, int bestMove);
+
+void TranspositionTable_free      (struct TranspositionTable* table);
\ No newline at end of file
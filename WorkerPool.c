@@ -0,0 +1,59 @@
+#include "WorkerPool.h"
+
+/*
+ * The work of every thread of the pool: does the jobs that are left, one at a time.
+ * A thread that can't allocate its search leaves its share to the other threads.
+ *
+ * @params: (arg) - the pool
+ */
+static void* doJobs(void* arg){
+	struct WorkerPool* pool = (struct WorkerPool*)arg;
+	struct TranspositionTable* table = TranspositionTable_new(pool->hashSize);
+	struct Search* search = (table != NULL)? Search_new(table, 1) : NULL;
+	void* job = (search != NULL)? malloc(pool->jobSize) : NULL;
+	while (job != NULL){
+		pthread_mutex_lock(&pool->lock);
+		int isTaken = pool->take(pool->batch, job);
+		pthread_mutex_unlock(&pool->lock);
+		if (!isTaken){
+			break;
+		}
+		pool->work(pool->batch, search, job);
+		pthread_mutex_lock(&pool->lock);
+		pool->finish(pool->batch, job);
+		pthread_mutex_unlock(&pool->lock);
+	}
+	free(job);
+	if (search != NULL){
+		Search_free(search);
+	}
+	if (table != NULL){
+		TranspositionTable_free(table);
+	}
+	return NULL;
+}
+
+/*
+ * Does all the jobs of a batch, and waits for all of them to be done.
+ *
+ * @params: (pool) - the pool, whose batch and functions must be filled in
+ *          (numOfThreads) - the number of threads in the pool, between 1 to WorkerPool_MAX_THREADS
+ * @return: the number of threads that were started; the batch tells whether all of its jobs were done,
+ *          since threads that can't allocate their searches do none
+ */
+int WorkerPool_run(struct WorkerPool* pool, int numOfThreads){
+	pthread_t threads[WorkerPool_MAX_THREADS];
+	pthread_mutex_init(&pool->lock, NULL);
+	int numOfStarted = 0;
+	while (numOfStarted < numOfThreads){
+		if (pthread_create(&threads[numOfStarted], NULL, &doJobs, pool) != 0){
+			break; // do the jobs with the threads that did start
+		}
+		numOfStarted++;
+	}
+	for (int i = 0; i < numOfStarted; i++){
+		pthread_join(threads[i], NULL);
+	}
+	pthread_mutex_destroy(&pool->lock);
+	return numOfStarted;
+}
@@ -0,0 +1,24 @@
+#include "Game.c"
+#include <pthread.h>
+
+#define WorkerPool_MAX_THREADS 64
+
+/*
+ * A pool of threads that share a batch of independent jobs, such as games or positions.
+ * Every thread has a single threaded search with a transposition table of its own, and a job
+ * of its own (jobSize bytes), with which it repeatedly takes the next job of the batch, does it,
+ * and finishes it, until no job is left. Taking and finishing a job are done under the pool's
+ * lock, so they may read and write the shared state of the batch; doing it is not, so the
+ * threads only wait for each other while the batch is updated.
+ */
+struct WorkerPool{
+	void* batch;
+	size_t jobSize;
+	int hashSize;   /* the size of every thread's transposition table, in megabytes */
+	int  (*take)  (void* batch, void* job);                        /* 0 (false) if no job is left */
+	void (*work)  (void* batch, struct Search* search, void* job);
+	void (*finish)(void* batch, void* job);
+	pthread_mutex_t lock;
+};
+
+int WorkerPool_run(struct WorkerPool* pool, int numOfThreads);